@@ -0,0 +1,46 @@
+﻿#ifndef HPP_CPP_MULTI_PRECISION_CPU_FEATURES
+#define HPP_CPP_MULTI_PRECISION_CPU_FEATURES
+
+#if !defined(CPP_MULTI_PRECISION_NO_SIMD) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CPP_MULTI_PRECISION_SIMD_X86
+#include <cpuid.h>
+#endif
+
+namespace cpp_multi_precision{
+    namespace aux{
+        struct cpu_features{
+            bool bmi2, adx, avx2, avx512f, avx512ifma;
+
+            static const cpu_features &get(){
+                static const cpu_features features = probe();
+                return features;
+            }
+
+        private:
+            static cpu_features probe(){
+                cpu_features f = { false, false, false, false, false };
+#ifdef CPP_MULTI_PRECISION_SIMD_X86
+                unsigned int a, b, c, d;
+                if(!__get_cpuid(1, &a, &b, &c, &d)){ return f; }
+                bool ymm = false, zmm = false;
+                if((c & (1u << 27)) != 0 && (c & (1u << 28)) != 0){
+                    unsigned int xcr0_lo, xcr0_hi;
+                    __asm__ __volatile__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+                    ymm = (xcr0_lo & 0x06u) == 0x06u;
+                    zmm = ymm && (xcr0_lo & 0xe0u) == 0xe0u;
+                }
+                if(__get_cpuid_max(0, 0) < 7){ return f; }
+                __cpuid_count(7, 0, a, b, c, d);
+                f.bmi2 = (b & (1u << 8)) != 0;
+                f.adx = (b & (1u << 19)) != 0;
+                f.avx2 = ymm && (b & (1u << 5)) != 0;
+                f.avx512f = zmm && (b & (1u << 16)) != 0;
+                f.avx512ifma = f.avx512f && (b & (1u << 21)) != 0;
+#endif
+                return f;
+            }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,229 @@
+#ifndef HPP_CPP_MULTI_PRECISION_EXPRESSION
+#define HPP_CPP_MULTI_PRECISION_EXPRESSION
+
+#include <utility>
+#include <type_traits>
+
+namespace cpp_multi_precision{
+    namespace expression{
+        struct plus_tag{};
+        struct minus_tag{};
+        struct multiplies_tag{};
+        struct divides_tag{};
+        struct modulus_tag{};
+
+        template<class Derived>
+        class node{
+        public:
+            const Derived &derived() const{
+                return static_cast<const Derived&>(*this);
+            }
+        };
+
+        template<class Integer>
+        class terminal : public node<terminal<Integer>>{
+        public:
+            typedef Integer integer_type;
+
+            explicit terminal(const Integer &value_) : value(value_){}
+
+            const Integer &value;
+        };
+
+        template<class Op, class L, class R>
+        class binary : public node<binary<Op, L, R>>{
+        public:
+            typedef typename L::integer_type integer_type;
+
+            binary(const L &lhs_, const R &rhs_) : lhs(lhs_), rhs(rhs_){}
+
+            const L lhs;
+            const R rhs;
+        };
+
+        template<class Integer>
+        terminal<Integer> lazy(const Integer &value){
+            return terminal<Integer>(value);
+        }
+
+        struct empty_storage{};
+
+        template<class Expr>
+        struct op_of{ typedef void type; };
+
+        template<class Op, class L, class R>
+        struct op_of<binary<Op, L, R>>{ typedef Op type; };
+
+        template<class Expr, class Integer>
+        struct operand_storage{ typedef Integer type; };
+
+        template<class Integer>
+        struct operand_storage<terminal<Integer>, Integer>{ typedef empty_storage type; };
+
+        template<class Integer>
+        struct evaluator{
+            template<class Expr>
+            static void assign(Integer &result, const Expr &e){
+                if(!refers(e, result)){
+                    eval(result, e);
+                }else if(!in_place(result, e)){
+                    Integer t;
+                    eval(t, e);
+                    result = std::move(t);
+                }
+            }
+
+            template<class Expr>
+            static void add(Integer &result, const Expr &e, bool negate){
+                if(!refers(e, result)){
+                    accumulate(result, e, negate);
+                }else{
+                    Integer t;
+                    eval(t, e);
+                    if(negate){ result -= t; }else{ result += t; }
+                }
+            }
+
+        private:
+            template<class Expr>
+            struct is_multiplies : std::is_same<typename op_of<Expr>::type, multiplies_tag>{};
+
+            static bool refers(const terminal<Integer> &e, const Integer &x){
+                return &e.value == &x;
+            }
+
+            template<class Op, class L, class R>
+            static bool refers(const binary<Op, L, R> &e, const Integer &x){
+                return refers(e.lhs, x) || refers(e.rhs, x);
+            }
+
+            template<class Expr>
+            static bool in_place(Integer&, const Expr&){
+                return false;
+            }
+
+            template<class R>
+            static bool in_place(Integer &result, const binary<plus_tag, terminal<Integer>, R> &e){
+                if(&e.lhs.value != &result || refers(e.rhs, result)){ return false; }
+                accumulate(result, e.rhs, false);
+                return true;
+            }
+
+            template<class R>
+            static bool in_place(Integer &result, const binary<minus_tag, terminal<Integer>, R> &e){
+                if(&e.lhs.value != &result || refers(e.rhs, result)){ return false; }
+                accumulate(result, e.rhs, true);
+                return true;
+            }
+
+            static const Integer &operand(const terminal<Integer> &e, empty_storage&){
+                return e.value;
+            }
+
+            template<class Op, class L, class R>
+            static const Integer &operand(const binary<Op, L, R> &e, Integer &t){
+                eval(t, e);
+                return t;
+            }
+
+            static void negate(Integer &x){
+                if(x != 0){ x.sign = !x.sign; }
+            }
+
+            static void addmul(Integer &result, const Integer &a, const Integer &b, bool negate){
+                if(negate){ Integer::submul(result, a, b); }else{ Integer::addmul(result, a, b); }
+            }
+
+            template<class L, class R>
+            static void accumulate(Integer &result, const binary<multiplies_tag, L, R> &e, bool negate){
+                typename operand_storage<L, Integer>::type s;
+                typename operand_storage<R, Integer>::type t;
+                const Integer &a(operand(e.lhs, s)), &b(operand(e.rhs, t));
+                addmul(result, a, b, negate);
+            }
+
+            template<class Expr>
+            static void accumulate(Integer &result, const Expr &e, bool negate){
+                typename operand_storage<Expr, Integer>::type t;
+                const Integer &a(operand(e, t));
+                if(negate){ result -= a; }else{ result += a; }
+            }
+
+            static void eval(Integer &result, const terminal<Integer> &e){
+                result = e.value;
+            }
+
+            template<class L, class R>
+            static void eval(Integer &result, const binary<plus_tag, L, R> &e){
+                if(is_multiplies<L>::value && !is_multiplies<R>::value){
+                    eval(result, e.rhs);
+                    accumulate(result, e.lhs, false);
+                }else{
+                    eval(result, e.lhs);
+                    accumulate(result, e.rhs, false);
+                }
+            }
+
+            template<class L, class R>
+            static void eval(Integer &result, const binary<minus_tag, L, R> &e){
+                if(is_multiplies<L>::value && !is_multiplies<R>::value){
+                    eval(result, e.rhs);
+                    negate(result);
+                    accumulate(result, e.lhs, false);
+                }else{
+                    eval(result, e.lhs);
+                    accumulate(result, e.rhs, true);
+                }
+            }
+
+            template<class L, class R>
+            static void eval(Integer &result, const binary<multiplies_tag, L, R> &e){
+                typename operand_storage<L, Integer>::type s;
+                typename operand_storage<R, Integer>::type t;
+                const Integer &a(operand(e.lhs, s)), &b(operand(e.rhs, t));
+                Integer::kar_multi(result, a, b);
+            }
+
+            template<class L, class R>
+            static void eval(Integer &result, const binary<divides_tag, L, R> &e){
+                typename operand_storage<L, Integer>::type s;
+                typename operand_storage<R, Integer>::type t;
+                const Integer &a(operand(e.lhs, s)), &b(operand(e.rhs, t));
+                Integer::div(result, a, b);
+            }
+
+            template<class L, class R>
+            static void eval(Integer &result, const binary<modulus_tag, L, R> &e){
+                typename operand_storage<L, Integer>::type s;
+                typename operand_storage<R, Integer>::type t;
+                const Integer &a(operand(e.lhs, s)), &b(operand(e.rhs, t));
+                Integer q;
+                Integer::div(q, result, a, b);
+            }
+        };
+
+#define CPP_MULTI_PRECISION_EXPRESSION_OPERATOR(op, tag) \
+        template<class L, class R> \
+        binary<tag, L, R> operator op(const node<L> &lhs, const node<R> &rhs){ \
+            return binary<tag, L, R>(lhs.derived(), rhs.derived()); \
+        } \
+        template<class L> \
+        binary<tag, L, terminal<typename L::integer_type>> operator op(const node<L> &lhs, const typename L::integer_type &rhs){ \
+            return binary<tag, L, terminal<typename L::integer_type>>(lhs.derived(), terminal<typename L::integer_type>(rhs)); \
+        } \
+        template<class R> \
+        binary<tag, terminal<typename R::integer_type>, R> operator op(const typename R::integer_type &lhs, const node<R> &rhs){ \
+            return binary<tag, terminal<typename R::integer_type>, R>(terminal<typename R::integer_type>(lhs), rhs.derived()); \
+        }
+
+        CPP_MULTI_PRECISION_EXPRESSION_OPERATOR(+, plus_tag)
+        CPP_MULTI_PRECISION_EXPRESSION_OPERATOR(-, minus_tag)
+        CPP_MULTI_PRECISION_EXPRESSION_OPERATOR(*, multiplies_tag)
+        CPP_MULTI_PRECISION_EXPRESSION_OPERATOR(/, divides_tag)
+        CPP_MULTI_PRECISION_EXPRESSION_OPERATOR(%, modulus_tag)
+
+#undef CPP_MULTI_PRECISION_EXPRESSION_OPERATOR
+    }
+}
+
+#endif
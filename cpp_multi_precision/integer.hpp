@@ -1,9 +1,17 @@
-#ifndef HPP_CPP_MULTI_PRECISION_INTEGER
+﻿#ifndef HPP_CPP_MULTI_PRECISION_INTEGER
 #define HPP_CPP_MULTI_PRECISION_INTEGER
 
 #include "unsigned_integer.hpp"
 
 namespace cpp_multi_precision{
+    namespace expression{
+        template<class Derived>
+        class node;
+
+        template<class Integer>
+        struct evaluator;
+    }
+
     template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator = std::allocator<RadixType>>
     class integer : public unsigned_integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>{
     public:
@@ -18,14 +26,18 @@ namespace cpp_multi_precision{
         typedef typename unsigned_integer_type::container_type container_type;
         typedef Allocator allocator_type;
 
+        template<class T, class R>
+        struct enable_if_word : boost::enable_if_c<std::is_integral<T>::value && sizeof(T) <= sizeof(unsigned_radix2_type), R>{};
+
         integer() : unsigned_integer_type(), sign(true){}
         integer(radix2_type value) : unsigned_integer_type(static_cast<unsigned_radix2_type>(value < 0 ? -value : value)), sign(value >= 0){}
         integer(const integer &other) : unsigned_integer_type(other.container), sign(other.sign){}
-        integer(integer &&other) : unsigned_integer_type(other), sign(other.sign){}
+        integer(integer &&other) CPP_MULTI_PRECISION_NOEXCEPT : unsigned_integer_type(static_cast<unsigned_integer_type&&>(other)), sign(other.sign){}
         integer(const container_type &other_container, bool sign_ = true) : unsigned_integer_type(other_container), sign(sign_){}
         template<class Iterator>
         integer(const Iterator &first, const Iterator &last, bool sign_ = true) : unsigned_integer_type(first, last), sign(sign_){}
-        virtual ~integer(){}
+        template<class Expr>
+        integer(const expression::node<Expr> &e) : unsigned_integer_type(), sign(true){ expression::evaluator<integer>::assign(*this, e.derived()); }
 
         void assign(const unsigned_integer_type &other){
             unsigned_integer_type::assign(other);
@@ -47,7 +59,7 @@ namespace cpp_multi_precision{
             sign = other.sign;
         }
 
-        void assign(integer &&other){
+        void assign(integer &&other) CPP_MULTI_PRECISION_NOEXCEPT{
             unsigned_integer_type::assign(static_cast<unsigned_integer_type&&>(other));
             sign = other.sign;
         }
@@ -107,12 +119,31 @@ namespace cpp_multi_precision{
             return *this;
         }
 
-        integer &operator =(integer &&other){
-            assign(other);
+        integer &operator =(integer &&other) CPP_MULTI_PRECISION_NOEXCEPT{
+            assign(std::move(other));
+            return *this;
+        }
+
+        template<class Expr>
+        integer &operator =(const expression::node<Expr> &e){
+            expression::evaluator<integer>::assign(*this, e.derived());
+            return *this;
+        }
+
+        template<class Expr>
+        integer &operator +=(const expression::node<Expr> &e){
+            expression::evaluator<integer>::add(*this, e.derived(), false);
+            return *this;
+        }
+
+        template<class Expr>
+        integer &operator -=(const expression::node<Expr> &e){
+            expression::evaluator<integer>::add(*this, e.derived(), true);
             return *this;
         }
 
         integer &operator +=(const integer &rhs){
+            if(add_small(rhs, rhs.sign)){ return *this; }
             unsigned_integer_type &ulhs(*this);
             const unsigned_integer_type &urhs(rhs);
             if(sign == rhs.sign){
@@ -138,6 +169,7 @@ namespace cpp_multi_precision{
         }
 
         integer &operator -=(const integer &rhs){
+            if(add_small(rhs, !rhs.sign)){ return *this; }
             unsigned_integer_type &ulhs(*this);
             const unsigned_integer_type &urhs(rhs);
             if(sign != rhs.sign){
@@ -275,7 +307,118 @@ namespace cpp_multi_precision{
             return sign != rhs.sign || ulhs != urhs;
         }
 
+        template<class T>
+        typename enable_if_word<T, integer&>::type operator +=(T rhs){
+            return add_word(word_magnitude(rhs), !word_negative(rhs));
+        }
+
+        template<class T>
+        typename enable_if_word<T, integer>::type operator +(T rhs) const{
+            integer r(*this);
+            r += rhs;
+            return std::move(r);
+        }
+
+        template<class T>
+        typename enable_if_word<T, integer&>::type operator -=(T rhs){
+            return add_word(word_magnitude(rhs), word_negative(rhs));
+        }
+
+        template<class T>
+        typename enable_if_word<T, integer>::type operator -(T rhs) const{
+            integer r(*this);
+            r -= rhs;
+            return std::move(r);
+        }
+
+        template<class T>
+        typename enable_if_word<T, integer&>::type operator *=(T rhs){
+            return multi_word(*this, *this, word_magnitude(rhs), !word_negative(rhs));
+        }
+
+        template<class T>
+        typename enable_if_word<T, integer>::type operator *(T rhs) const{
+            integer r;
+            multi_word(r, *this, word_magnitude(rhs), !word_negative(rhs));
+            return std::move(r);
+        }
+
+        template<class T>
+        typename enable_if_word<T, integer&>::type operator /=(T rhs){
+            unsigned_radix2_type v = word_magnitude(rhs);
+            if((v >> radix_log2) != 0){ return *this /= word_integer(v, !word_negative(rhs)); }
+            div_word(*this, *this, static_cast<radix_type>(v), !word_negative(rhs));
+            return *this;
+        }
+
+        template<class T>
+        typename enable_if_word<T, integer>::type operator /(T rhs) const{
+            unsigned_radix2_type v = word_magnitude(rhs);
+            if((v >> radix_log2) != 0){ return *this / word_integer(v, !word_negative(rhs)); }
+            integer r;
+            div_word(r, *this, static_cast<radix_type>(v), !word_negative(rhs));
+            return std::move(r);
+        }
+
+        template<class T>
+        typename enable_if_word<T, integer&>::type operator %=(T rhs){
+            unsigned_radix2_type v = word_magnitude(rhs);
+            if((v >> radix_log2) != 0){
+                assign(*this % word_integer(v, !word_negative(rhs)));
+            }else{
+                mod_word(*this, *this, static_cast<radix_type>(v), !word_negative(rhs));
+            }
+            return *this;
+        }
+
+        template<class T>
+        typename enable_if_word<T, integer>::type operator %(T rhs) const{
+            unsigned_radix2_type v = word_magnitude(rhs);
+            if((v >> radix_log2) != 0){ return *this % word_integer(v, !word_negative(rhs)); }
+            integer r;
+            mod_word(r, *this, static_cast<radix_type>(v), !word_negative(rhs));
+            return std::move(r);
+        }
+
+        template<class T>
+        typename enable_if_word<T, bool>::type operator <(T rhs) const{
+            return compare_word(word_magnitude(rhs), word_negative(rhs)) < 0;
+        }
+
+        template<class T>
+        typename enable_if_word<T, bool>::type operator >(T rhs) const{
+            return compare_word(word_magnitude(rhs), word_negative(rhs)) > 0;
+        }
+
+        template<class T>
+        typename enable_if_word<T, bool>::type operator <=(T rhs) const{
+            return compare_word(word_magnitude(rhs), word_negative(rhs)) <= 0;
+        }
+
+        template<class T>
+        typename enable_if_word<T, bool>::type operator >=(T rhs) const{
+            return compare_word(word_magnitude(rhs), word_negative(rhs)) >= 0;
+        }
+
+        template<class T>
+        typename enable_if_word<T, bool>::type operator ==(T rhs) const{
+            return compare_word(word_magnitude(rhs), word_negative(rhs)) == 0;
+        }
+
+        template<class T>
+        typename enable_if_word<T, bool>::type operator !=(T rhs) const{
+            return compare_word(word_magnitude(rhs), word_negative(rhs)) != 0;
+        }
+
     private:
+        template<class Integer>
+        friend struct expression::evaluator;
+
+        static const std::size_t threshold_toom3_multi = 400;
+        static const std::size_t threshold_toom4_multi = 1000;
+        static const std::size_t threshold_toom3_square = 400;
+        static const std::size_t threshold_toom4_square = 1000;
+
         struct kar_pair{
             kar_pair(typename container_type::iterator f, typename container_type::iterator s, std::size_t n) : first(f), second(s), size(n){}
             const typename container_type::iterator first, second;
@@ -343,10 +486,49 @@ namespace cpp_multi_precision{
             return std::move(a);
         }
 
+        static integer &sqrtrem(integer &result, integer &rem, const integer &a){
+            unsigned_integer_type::sqrtrem(result, rem, a);
+            result.sign = true, rem.sign = true;
+            return result;
+        }
+
+        static bool is_perfect_square(const integer &a){
+            return (a.sign || a == 0) && unsigned_integer_type::is_perfect_square(a);
+        }
+
+        bool is_perfect_square() const{
+            return is_perfect_square(*this);
+        }
+
+        static integer &rootrem(integer &result, integer &rem, const integer &a, std::size_t k){
+            unsigned_integer_type::rootrem(result, rem, a, k);
+            result.sign = a.sign || k % 2 == 0 || result == 0, rem.sign = a.sign || rem == 0;
+            return result;
+        }
+
+        static integer &root(integer &result, const integer &a, std::size_t k){
+            integer rem;
+            return rootrem(result, rem, a, k);
+        }
+
+        integer root(std::size_t k) const{
+            integer r;
+            root(r, *this, k);
+            return std::move(r);
+        }
+
+        static bool is_perfect_power(const integer &a){
+            return unsigned_integer_type::is_perfect_power_impl(a, !a.sign);
+        }
+
+        bool is_perfect_power() const{
+            return is_perfect_power(*this);
+        }
+
         static integer &pow(integer &result, const integer &x, const integer &y){
             if(y.sign == true){
                 if(y == 0){ result.assign(1); }else{
-                    unsigned_integer_type::template pow_impl<false>(result, x, y, kar_multi);
+                    unsigned_integer_type::template pow_impl<false>(result, x, y, kar_multi, square);
                     if(!x.sign && (x.container[0] & 1) == 0){
                         result.sign = true;
                     }
@@ -365,8 +547,12 @@ namespace cpp_multi_precision{
 
         static integer &pow_mod(integer &result, const integer &x, const integer &y, const integer &m){
             if(y.sign == true){
-                if(y == 0){ result.assign(1); }else{
-                    unsigned_integer_type::template pow_impl<true>(result, x, y, kar_multi, m);
+                if(y == 0){ result.assign(1); }else if(m.sign && (m.container[0] & 1) == 1){
+                    typename unsigned_integer_type::montgomery ctx(m);
+                    ctx.pow(result, x, y);
+                    result.sign = true;
+                }else{
+                    unsigned_integer_type::template pow_impl<true>(result, x, y, kar_multi, square, m);
                     if(!x.sign && (x.container[0] & 1) == 0){
                         result.sign = true;
                     }
@@ -383,6 +569,98 @@ namespace cpp_multi_precision{
             return std::move(r);
         }
 
+        class reciprocal{
+        public:
+            reciprocal(const integer &d) : impl(d), sign(d.sign){}
+
+            integer &div(integer &result, integer &rem, const integer &a) const{
+                if(a == 0){
+                    result = 0, rem = 0;
+                    return result;
+                }
+                impl.div(result, rem, a);
+                if(a.sign != sign){
+                    static_cast<unsigned_integer_type&>(result) += 1;
+                }
+                result.sign = static_cast<unsigned_integer_type&>(result) == 0 || a.sign == sign;
+                rem.sign = sign;
+                return result;
+            }
+
+            integer &mod(integer &rem, const integer &a) const{
+                integer result;
+                div(result, rem, a);
+                return rem;
+            }
+
+            integer divisor_value() const{
+                integer r;
+                static_cast<unsigned_integer_type&>(r) = impl.divisor_value();
+                r.sign = sign;
+                return std::move(r);
+            }
+
+        private:
+            typename unsigned_integer_type::reciprocal impl;
+            bool sign;
+        };
+
+        static integer &divexact(integer &result, const integer &lhs, const integer &rhs){
+            bool s = lhs.sign == rhs.sign;
+            unsigned_integer_type::divexact(result, lhs, rhs);
+            result.sign = s || result.is_zero();
+            return result;
+        }
+
+        static integer divexact(const integer &lhs, const integer &rhs){
+            integer r;
+            divexact(r, lhs, rhs);
+            return std::move(r);
+        }
+
+        static integer &addmul(integer &acc, const integer &a, const integer &b){
+            return addmul_impl(acc, a, b, a.sign == b.sign);
+        }
+
+        static integer &submul(integer &acc, const integer &a, const integer &b){
+            return addmul_impl(acc, a, b, a.sign != b.sign);
+        }
+
+        template<class Iterator1, class Iterator2>
+        static integer &dot(integer &result, Iterator1 first_a, Iterator1 last_a, Iterator2 first_b){
+            std::size_t n = 0;
+            Iterator2 iter_b = first_b;
+            for(Iterator1 iter_a = first_a; iter_a != last_a; ++iter_a, ++iter_b){
+                n = (std::max)(n, iter_a->container.size() + iter_b->container.size());
+            }
+            integer pos, neg, p;
+            pos.container.assign(n + 2, 0), neg.container.assign(n + 2, 0);
+            for(iter_b = first_b; first_a != last_a; ++first_a, ++iter_b){
+                const integer &a(*first_a), &b(*iter_b);
+                if(a.is_zero() || b.is_zero()){ continue; }
+                container_type &acc((a.sign == b.sign ? pos : neg).container);
+                if((std::min)(a.container.size(), b.container.size()) < unsigned_integer_type::threshold_kar_multi){
+                    addmul_rows(&acc[0], acc.size(), a, b);
+                }else{
+                    kar_multi(p, a, b);
+                    std::size_t pn = p.container.size();
+                    radix_type c = unsigned_integer_type::kernel_type::add_n(&acc[0], &acc[0], &p.container[0], pn);
+                    unsigned_integer_type::kernel_type::incr(&acc[pn], acc.size() - pn, c);
+                }
+            }
+            pos.normalize_container_impl(), neg.normalize_container_impl();
+            pos -= neg;
+            result = std::move(pos);
+            return result;
+        }
+
+        template<class Iterator1, class Iterator2>
+        static integer dot(Iterator1 first_a, Iterator1 last_a, Iterator2 first_b){
+            integer r;
+            dot(r, first_a, last_a, first_b);
+            return std::move(r);
+        }
+
         static integer &gcd(integer &result, const integer &lhs, const integer &rhs){
             const unsigned_integer_type &ulhs(lhs), &urhs(rhs);
             if(ulhs >= urhs){
@@ -392,12 +670,34 @@ namespace cpp_multi_precision{
             }
         }
 
-        static integer &gcd(const integer &lhs, const integer &rhs){
+        static integer gcd(const integer &lhs, const integer &rhs){
             integer r;
             gcd(r, lhs, rhs);
             return std::move(r);
         }
 
+        static integer &eea(integer &result, integer &s, integer &t, const integer &f, const integer &g){
+            const unsigned_integer_type &uf(f), &ug(g);
+            bool neg;
+            if(uf >= ug){
+                unsigned_integer_type::gcdext_impl(result, s, t, neg, f, g);
+                s.sign = !neg, t.sign = neg;
+            }else{
+                unsigned_integer_type::gcdext_impl(result, t, s, neg, g, f);
+                t.sign = !neg, s.sign = neg;
+            }
+            s.sign = s == 0 || s.sign == f.sign;
+            t.sign = t == 0 || t.sign == g.sign;
+            result.sign = true;
+            return result;
+        }
+
+        static integer eea(integer &s, integer &t, const integer &f, const integer &g){
+            integer r;
+            eea(r, s, t, f, g);
+            return std::move(r);
+        }
+
         radix_type lc() const{ return unsigned_integer_type::lc(); }
 
         static integer &normal(integer &result, const integer &x){
@@ -473,7 +773,11 @@ namespace cpp_multi_precision{
                     double_g_iter != double_g_end;
                     ++double_g_iter
                 ){ *double_g_iter = *double_g_iter * 2; }
-                next_g -= f * g * g;
+                {
+                    integer gg;
+                    square(gg, g);
+                    next_g -= f * gg;
+                }
                 if(next_g.container.size() >= rem){ next_g.container.resize(rem - 1); }
                 g = std::move(next_g);
             }
@@ -487,9 +791,11 @@ namespace cpp_multi_precision{
         }
 
         static integer &modular_inverse(integer &result, const integer &a, const integer &m){
-            result = 0;
-            eea(integer(), result, integer(), a, m);
-            if(!result.sign){ result += m; }
+            integer g, t;
+            eea(g, result, t, a, m);
+            bool sign = result.sign;
+            result = result % m;
+            if(!sign && result != 0){ result = m - result; }
             return result;
         }
 
@@ -536,9 +842,16 @@ namespace cpp_multi_precision{
         }
 
         static integer &kar_multi(integer &result, const integer &lhs, const integer &rhs){
+            if(lhs.container.size() == 1 && rhs.container.size() == 1){
+                unsigned_radix2_type v = static_cast<unsigned_radix2_type>(lhs.container[0]) * rhs.container[0];
+                bool s = v == 0 || lhs.sign == rhs.sign;
+                result.unsigned_integer_type::assign(v);
+                result.sign = s;
+                return result;
+            }
             result.assign(0);
             aux::reserve_dispatch(result.container, lhs.container.size() + rhs.container.size());
-            kar_multi_impl(
+            multi_impl(
                 result,
                 kar_const_pair(lhs.container.begin(), lhs.container.end(), lhs.container.size()),
                 kar_const_pair(rhs.container.begin(), rhs.container.end(), rhs.container.size())
@@ -551,6 +864,22 @@ namespace cpp_multi_precision{
             return result;
         }
 
+        static integer &square(integer &result, const integer &x){
+            std::size_t n = x.container.size();
+            if(n < threshold_toom3_square || (n >= unsigned_integer_type::threshold_ntt_square && unsigned_integer_type::ntt_multi_enable(n, n))){
+                unsigned_integer_type::square(result, x);
+            }else{
+                kar_const_pair p(x.container.begin(), x.container.end(), n);
+                if(n < threshold_toom4_square){
+                    toom3_square_impl(result, p);
+                }else{
+                    toom4_square_impl(result, p);
+                }
+            }
+            result.sign = true;
+            return result;
+        }
+
         static std::size_t mshift_left(std::size_t x, std::size_t i){
             if(i < sizeof(std::size_t) * 8){
                 return x << i;
@@ -567,13 +896,64 @@ namespace cpp_multi_precision{
             }
         }
 
+        bool is_zero() const{
+            return unsigned_integer_type::container.size() == 1 && unsigned_integer_type::container[0] == 0;
+        }
+
+        static void addmul_rows(radix_type *r, std::size_t rn, const integer &a, const integer &b){
+            const container_type &x(a.container.size() >= b.container.size() ? a.container : b.container);
+            const container_type &y(a.container.size() >= b.container.size() ? b.container : a.container);
+            std::size_t xn = x.size(), yn = y.size();
+            for(std::size_t j = 0; j < yn; ++j){
+                radix_type c = unsigned_integer_type::kernel_type::addmul_1(r + j, &x[0], xn, y[j]);
+                unsigned_integer_type::kernel_type::incr(r + j + xn, rn - j - xn, c);
+            }
+        }
+
+        static radix_type submul_rows(radix_type *r, std::size_t rn, const integer &a, const integer &b){
+            const container_type &x(a.container.size() >= b.container.size() ? a.container : b.container);
+            const container_type &y(a.container.size() >= b.container.size() ? b.container : a.container);
+            std::size_t xn = x.size(), yn = y.size();
+            radix_type borrow = 0;
+            for(std::size_t j = 0; j < yn; ++j){
+                radix_type c = unsigned_integer_type::kernel_type::submul_1(r + j, &x[0], xn, y[j]);
+                borrow |= unsigned_integer_type::kernel_type::decr(r + j + xn, rn - j - xn, c);
+            }
+            return borrow;
+        }
+
+        static integer &addmul_impl(integer &acc, const integer &a, const integer &b, bool product_sign){
+            if(a.is_zero() || b.is_zero()){ return acc; }
+            std::size_t an = a.container.size(), bn = b.container.size();
+            if(&acc == &a || &acc == &b || (std::min)(an, bn) >= unsigned_integer_type::threshold_kar_multi){
+                integer p;
+                kar_multi(p, a, b);
+                p.sign = product_sign;
+                return acc += p;
+            }
+            if(acc.is_zero()){ acc.sign = product_sign; }
+            container_type &r(acc.container);
+            std::size_t rn = (std::max)(r.size(), an + bn) + 1;
+            r.resize(rn, 0);
+            if(acc.sign == product_sign){
+                addmul_rows(&r[0], rn, a, b);
+            }else if(submul_rows(&r[0], rn, a, b) != 0){
+                for(std::size_t i = 0; i < rn; ++i){ r[i] = ~r[i]; }
+                unsigned_integer_type::kernel_type::incr(&r[0], rn, 1);
+                acc.sign = !acc.sign;
+            }
+            acc.normalize_container_impl();
+            if(acc.is_zero()){ acc.sign = true; }
+            return acc;
+        }
+
         template<bool Rem>
         static integer &div_impl(integer &result, integer &rem, const integer &lhs, const integer &rhs){
             if(lhs == 0){
                 result = 0, rem = 0;
                 return result;
             }
-            monic_div_impl<Rem>(result, rem, lhs, rhs);
+            square_div<Rem>(result, rem, lhs, rhs);
             if(static_cast<unsigned_integer_type&>(result) == 0){
                 result.sign = true;
             }else{
@@ -604,46 +984,217 @@ namespace cpp_multi_precision{
             return result;
         }
 
-        static void kar_multi_impl(integer &result, kar_const_pair x, kar_const_pair y){
-            std::size_t n = aux::ceil_pow2((std::max)(x.size, y.size));
-            if(n < 2){
-                unsigned_integer_type &uresult(result);
-                unsigned_integer_type::square_multi(uresult, x.first, x.second, y.first, y.second, x.size, y.size);
+        static void multi_impl(integer &result, const kar_const_pair &x, const kar_const_pair &y){
+            if(x.size < y.size){
+                multi_impl(result, y, x);
                 return;
             }
-            n /= 2;
-            std::size_t xn = x.size < n ? x.size : n, yn = y.size < n ? y.size : n;
-            kar_const_pair x1(x.first + xn, x.second, x.size - xn), y1(y.first + yn, y.second, y.size - yn);
-            kar_const_pair x0(x.first, x.first + xn, xn), y0(y.first, y.first + yn, yn);
-            integer z2, z0;
-            {
-                integer tx, ty;
-                if(x1.first != x1.second){
-                    tx.assign(x1.first, x1.second), tx.sub_iterator_n(true, x0.first, x0.second, 0);
+            if(y.size < unsigned_integer_type::threshold_kar_multi){
+                container_type &r_container(result.container);
+                r_container.resize(x.size + y.size);
+                unsigned_integer_type::kernel_type::mul_basecase(&r_container[0], &*x.first, x.size, &*y.first, y.size);
+                result.normalize_container_impl();
+                return;
+            }
+            if(y.size >= unsigned_integer_type::threshold_ntt_multi && unsigned_integer_type::ntt_multi_enable(x.size, y.size)){
+                unsigned_integer_type &uresult(result);
+                unsigned_integer_type::ntt_multi(uresult, x.first, x.second, y.first, y.second, x.size, y.size);
+            }else if(x.size >= y.size * 2){
+                unbalanced_multi_impl(result, x, y);
+            }else if(y.size < threshold_toom3_multi){
+                kar_multi_impl(result, x, y);
+            }else if(y.size < threshold_toom4_multi){
+                if(x.size * 4 >= y.size * 5){
+                    toom32_multi_impl(result, x, y);
                 }else{
-                    tx.assign(x0.first, x0.second), tx.sign = false;
+                    toom33_multi_impl(result, x, y);
                 }
-                if(y1.first != y1.second){
-                    ty.assign(y1.first, y1.second), ty.sub_iterator_n(true, y0.first, y0.second, 0);
+            }else{
+                if(x.size * 2 >= y.size * 3){
+                    toom42_multi_impl(result, x, y);
                 }else{
-                    ty.assign(y0.first, y0.second), ty.sign = false;
+                    toom44_multi_impl(result, x, y);
                 }
-                kar_multi_impl(result, kar_const_pair(tx.container.begin(), tx.container.end(), tx.container.size()), kar_const_pair(ty.container.begin(), ty.container.end(), ty.container.size()));
-                result.sign = tx.sign != ty.sign;
             }
-            kar_multi_impl(z0, x0, y0);
-            (z0.*(&integer::normalize_container_impl))();
-            result += z0;
-            if(x.size >= n && y.size >= n){
-                kar_multi_impl(z2, x1, y1);
-                result += z2;
+        }
+
+        static void unbalanced_multi_impl(integer &result, const kar_const_pair &x, const kar_const_pair &y){
+            result.assign(0);
+            integer z;
+            for(std::size_t i = 0; i < x.size; i += y.size){
+                std::size_t m = (std::min)(y.size, x.size - i);
+                z.assign(0);
+                multi_impl(z, kar_const_pair(x.first + i, x.first + (i + m), m), y);
+                result.add_radix_n(z, i);
+            }
+            result.normalize_container_impl();
+        }
+
+        static void kar_multi_impl(integer &result, const kar_const_pair &x, const kar_const_pair &y){
+            container_type &r_container(result.container);
+            r_container.resize(x.size + y.size);
+            typename unsigned_integer_type::scratch_type scratch(unsigned_integer_type::kar_scratch_size(x.size, unsigned_integer_type::threshold_kar_multi) + 1);
+            unsigned_integer_type::kar_multi_raw(&r_container[0], &*x.first, x.size, &*y.first, y.size, &scratch[0]);
+            result.normalize_container_impl();
+        }
+
+        static integer toom_piece(const kar_const_pair &x, std::size_t n, std::size_t i){
+            std::size_t s = (std::min)(n * i, x.size), e = (std::min)(s + n, x.size);
+            return integer(x.first + s, x.first + e);
+        }
+
+        static void toom_divexact(integer &a, radix_type v){
+            a.divexact_radix(v);
+            if(static_cast<unsigned_integer_type&>(a) == 0){ a.sign = true; }
+        }
+
+        static void toom_recompose(integer &result, std::size_t n, const integer *r, std::size_t k){
+            result.assign(r[0]);
+            for(std::size_t i = 1; i < k; ++i){
+                result.add_radix_n(r[i], n * i);
+            }
+            result.normalize_container_impl();
+        }
+
+        static void toom_interpolate5(integer &result, std::size_t n, integer &v0, integer &v1, integer &vm1, integer &vm2, integer &vinf){
+            integer r[5];
+            r[3] = vm2 - v1, toom_divexact(r[3], 3);
+            r[1] = v1 - vm1, r[1] >>= 1;
+            r[2] = vm1 - v0;
+            r[3] = r[2] - r[3], r[3] >>= 1, r[3] += vinf << 1;
+            r[2] += r[1], r[2] -= vinf;
+            r[1] -= r[3];
+            r[0] = std::move(v0), r[4] = std::move(vinf);
+            toom_recompose(result, n, r, 5);
+        }
+
+        static void toom_interpolate7(integer &result, std::size_t n, integer &v0, integer &v1, integer &vm1, integer &v2, integer &vm2, integer &vh, integer &vinf){
+            integer r[7];
+            r[0] = std::move(v0), r[6] = std::move(vinf);
+            integer o1(v1 - vm1), o2(v2 - vm2), a(v1 + vm1), b(v2 + vm2);
+            o1 >>= 1, o2 >>= 2;
+            a >>= 1, a -= r[0], a -= r[6];
+            b >>= 1, b -= r[0], b -= r[6] << 6, b >>= 2;
+            r[4] = b - a, toom_divexact(r[4], 3);
+            r[2] = a - r[4];
+            vh -= r[0] << 6, vh -= r[2] << 4, vh -= r[4] << 2, vh -= r[6], vh >>= 1;
+            vh -= o1, toom_divexact(vh, 3);
+            o2 -= o1, toom_divexact(o2, 3);
+            r[3] = o1 * 5, r[3] -= vh, r[3] -= o2, toom_divexact(r[3], 3);
+            r[1] = vh - r[3], toom_divexact(r[1], 5);
+            r[5] = o2 - r[3], toom_divexact(r[5], 5);
+            toom_recompose(result, n, r, 7);
+        }
+
+        static void toom32_multi_impl(integer &result, const kar_const_pair &x, const kar_const_pair &y){
+            std::size_t n = (std::max)((x.size + 2) / 3, (y.size + 1) / 2);
+            integer x0(toom_piece(x, n, 0)), x1(toom_piece(x, n, 1)), x2(toom_piece(x, n, 2));
+            integer y0(toom_piece(y, n, 0)), y1(toom_piece(y, n, 1));
+            integer r[4], v1, vm1;
+            {
+                integer p(x0 + x2);
+                kar_multi(v1, p + x1, y0 + y1);
+                kar_multi(vm1, p - x1, y0 - y1);
             }
-            result.radix_shift(n);
-            result += z0;
-            if(x.size >= n && y.size >= n){
-                result.add_radix_n(z2, n * 2);
+            kar_multi(r[0], x0, y0);
+            kar_multi(r[3], x2, y1);
+            r[1] = v1 - vm1, r[1] >>= 1, r[1] -= r[3];
+            r[2] = v1 + vm1, r[2] >>= 1, r[2] -= r[0];
+            toom_recompose(result, n, r, 4);
+        }
+
+        static void toom33_multi_impl(integer &result, const kar_const_pair &x, const kar_const_pair &y){
+            std::size_t n = (std::max)((x.size + 2) / 3, (y.size + 2) / 3);
+            integer x0(toom_piece(x, n, 0)), x1(toom_piece(x, n, 1)), x2(toom_piece(x, n, 2));
+            integer y0(toom_piece(y, n, 0)), y1(toom_piece(y, n, 1)), y2(toom_piece(y, n, 2));
+            integer v0, v1, vm1, vm2, vinf;
+            {
+                integer p(x0 + x2), q(y0 + y2);
+                kar_multi(v1, p + x1, q + y1);
+                p -= x1, q -= y1;
+                kar_multi(vm1, p, q);
+                p += x2, p <<= 1, p -= x0;
+                q += y2, q <<= 1, q -= y0;
+                kar_multi(vm2, p, q);
+            }
+            kar_multi(v0, x0, y0);
+            kar_multi(vinf, x2, y2);
+            toom_interpolate5(result, n, v0, v1, vm1, vm2, vinf);
+        }
+
+        static void toom42_multi_impl(integer &result, const kar_const_pair &x, const kar_const_pair &y){
+            std::size_t n = (std::max)((x.size + 3) / 4, (y.size + 1) / 2);
+            integer x0(toom_piece(x, n, 0)), x1(toom_piece(x, n, 1)), x2(toom_piece(x, n, 2)), x3(toom_piece(x, n, 3));
+            integer y0(toom_piece(y, n, 0)), y1(toom_piece(y, n, 1));
+            integer v0, v1, vm1, vm2, vinf;
+            {
+                integer p(x0 + x2), q(x1 + x3);
+                kar_multi(v1, p + q, y0 + y1);
+                kar_multi(vm1, p - q, y0 - y1);
+                p = x0 + (x2 << 2), q = (x1 << 1) + (x3 << 3);
+                kar_multi(vm2, p - q, y0 - (y1 << 1));
+            }
+            kar_multi(v0, x0, y0);
+            kar_multi(vinf, x3, y1);
+            toom_interpolate5(result, n, v0, v1, vm1, vm2, vinf);
+        }
+
+        static void toom44_multi_impl(integer &result, const kar_const_pair &x, const kar_const_pair &y){
+            std::size_t n = (std::max)((x.size + 3) / 4, (y.size + 3) / 4);
+            integer x0(toom_piece(x, n, 0)), x1(toom_piece(x, n, 1)), x2(toom_piece(x, n, 2)), x3(toom_piece(x, n, 3));
+            integer y0(toom_piece(y, n, 0)), y1(toom_piece(y, n, 1)), y2(toom_piece(y, n, 2)), y3(toom_piece(y, n, 3));
+            integer v0, v1, vm1, v2, vm2, vh, vinf;
+            {
+                integer p(x0 + x2), q(x1 + x3), s(y0 + y2), t(y1 + y3);
+                kar_multi(v1, p + q, s + t);
+                kar_multi(vm1, p - q, s - t);
+                p = x0 + (x2 << 2), q = (x1 << 1) + (x3 << 3);
+                s = y0 + (y2 << 2), t = (y1 << 1) + (y3 << 3);
+                kar_multi(v2, p + q, s + t);
+                kar_multi(vm2, p - q, s - t);
+                p = (x0 << 3) + (x1 << 2) + (x2 << 1) + x3;
+                s = (y0 << 3) + (y1 << 2) + (y2 << 1) + y3;
+                kar_multi(vh, p, s);
+            }
+            kar_multi(v0, x0, y0);
+            kar_multi(vinf, x3, y3);
+            toom_interpolate7(result, n, v0, v1, vm1, v2, vm2, vh, vinf);
+        }
+
+        static void toom3_square_impl(integer &result, const kar_const_pair &x){
+            std::size_t n = (x.size + 2) / 3;
+            integer x0(toom_piece(x, n, 0)), x1(toom_piece(x, n, 1)), x2(toom_piece(x, n, 2));
+            integer v0, v1, vm1, vm2, vinf;
+            {
+                integer p(x0 + x2);
+                square(v1, p + x1);
+                p -= x1;
+                square(vm1, p);
+                p += x2, p <<= 1, p -= x0;
+                square(vm2, p);
+            }
+            square(v0, x0);
+            square(vinf, x2);
+            toom_interpolate5(result, n, v0, v1, vm1, vm2, vinf);
+        }
+
+        static void toom4_square_impl(integer &result, const kar_const_pair &x){
+            std::size_t n = (x.size + 3) / 4;
+            integer x0(toom_piece(x, n, 0)), x1(toom_piece(x, n, 1)), x2(toom_piece(x, n, 2)), x3(toom_piece(x, n, 3));
+            integer v0, v1, vm1, v2, vm2, vh, vinf;
+            {
+                integer p(x0 + x2), q(x1 + x3);
+                square(v1, p + q);
+                square(vm1, p - q);
+                p = x0 + (x2 << 2), q = (x1 << 1) + (x3 << 3);
+                square(v2, p + q);
+                square(vm2, p - q);
+                p = (x0 << 3) + (x1 << 2) + (x2 << 1) + x3;
+                square(vh, p);
             }
-            (result.*(&integer::normalize_container_impl))();
+            square(v0, x0);
+            square(vinf, x3);
+            toom_interpolate7(result, n, v0, v1, vm1, v2, vm2, vh, vinf);
         }
 
         void sub_iterator_n(bool rhs_sign, const typename container_type::const_iterator &rhs_first, typename container_type::const_iterator rhs_last, std::size_t n){
@@ -682,35 +1233,124 @@ namespace cpp_multi_precision{
             return result;
         }
 
-        template<bool Rem>
-        static integer &monic_div_impl(integer &result, integer &rem, const integer &lhs, const integer &rhs){
-            if(!rhs.is_monic()){
-                square_div<Rem>(result, rem, lhs, rhs);
+        bool add_small(const integer &rhs, bool rhs_sign){
+            unsigned_radix2_type x, y;
+            if(!this->small_value(x) || !rhs.small_value(y)){ return false; }
+            return add_small(x, y, rhs_sign);
+        }
+
+        bool add_small(unsigned_radix2_type x, unsigned_radix2_type y, bool rhs_sign){
+            if(sign == rhs_sign){
+                if(x + y < x){ return false; }
+                unsigned_integer_type::assign(x + y);
+            }else if(x >= y){
+                unsigned_integer_type::assign(x - y);
+                if(x == y){ sign = true; }
+            }else{
+                unsigned_integer_type::assign(y - x);
+                sign = rhs_sign;
+            }
+            return true;
+        }
+
+        template<class T>
+        static bool word_negative(T v){
+            return v < static_cast<T>(0);
+        }
+
+        template<class T>
+        static unsigned_radix2_type word_magnitude(T v){
+            return word_negative(v) ? static_cast<unsigned_radix2_type>(0) - static_cast<unsigned_radix2_type>(v) : static_cast<unsigned_radix2_type>(v);
+        }
+
+        static integer word_integer(unsigned_radix2_type v, bool v_sign){
+            integer r;
+            r.unsigned_integer_type::assign(v);
+            r.sign = v_sign || v == 0;
+            return std::move(r);
+        }
+
+        integer &add_word(unsigned_radix2_type v, bool v_sign){
+            if(v == 0){ return *this; }
+            unsigned_radix2_type x;
+            if(this->small_value(x) && add_small(x, v, v_sign)){ return *this; }
+            container_type &c(unsigned_integer_type::container);
+            radix_type w[2] = { static_cast<radix_type>(v), static_cast<radix_type>(v >> radix_log2) };
+            std::size_t wn = w[1] != 0 ? 2 : 1;
+            if(sign == v_sign){
+                if(c.size() < wn){ c.resize(wn, 0); }
+                radix_type carry = unsigned_integer_type::kernel_type::add_n(&c[0], &c[0], w, wn);
+                carry = unsigned_integer_type::kernel_type::incr(&c[wn], c.size() - wn, carry);
+                if(carry != 0){ c.push_back(carry); }
+            }else{
+                radix_type borrow = unsigned_integer_type::kernel_type::sub_n(&c[0], &c[0], w, wn);
+                unsigned_integer_type::kernel_type::decr(&c[wn], c.size() - wn, borrow);
+                this->normalize_container_impl();
+            }
+            return *this;
+        }
+
+        static integer &multi_word(integer &result, const integer &x, unsigned_radix2_type v, bool v_sign){
+            if(v == 0 || x.is_zero()){
+                result.assign(0);
                 return result;
             }
-            result = 0;
-            if(rhs.container.size() > lhs.container.size()){
-                if(Rem){ rem = lhs; }
+            if((v >> radix_log2) != 0){
+                integer r;
+                kar_multi(r, x, word_integer(v, v_sign));
+                result = std::move(r);
                 return result;
             }
-            std::size_t m = lhs.container.size() - rhs.container.size() + 1;
-            integer inv_rev_rhs;
-            {
-                integer rev_rhs(rhs);
-                rev_rhs.rev();
-                inverse(inv_rev_rhs, rev_rhs, m);
+            bool s = x.sign == v_sign;
+            std::size_t n = x.container.size();
+            if(&result != &x){
+                aux::reserve_dispatch(result.container, n + 1);
+                result.container.resize(n);
             }
-            {
-                integer rev_lhs(lhs);
-                rev_lhs.rev();
-                result = rev_lhs * std::move(inv_rev_rhs);
+            radix_type c = unsigned_integer_type::kernel_type::mul_1(&result.container[0], &x.container[0], n, static_cast<radix_type>(v));
+            if(c != 0){ result.container.push_back(c); }
+            result.sign = s;
+            return result;
+        }
+
+        static integer &div_word(integer &result, const integer &x, radix_type d, bool d_sign){
+            if(x.is_zero()){
+                result.assign(0);
+                return result;
             }
-            if(result.container.size() > m){ result.container.resize(m); }
-            result.rev();
-            if(Rem){ rem = lhs - rhs * result; }
+            bool s = x.sign == d_sign;
+            std::size_t n = x.container.size();
+            if(&result != &x){ result.container.resize(n); }
+            unsigned_integer_type::kernel_type::divrem_1(&result.container[0], &x.container[0], n, d);
+            result.normalize_container_impl();
+            if(!s){
+                radix_type c = unsigned_integer_type::kernel_type::incr(&result.container[0], result.container.size(), 1);
+                if(c != 0){ result.container.push_back(c); }
+            }
+            result.sign = s || result.is_zero();
             return result;
         }
 
+        static integer &mod_word(integer &result, const integer &x, radix_type d, bool d_sign){
+            if(x.is_zero()){
+                result.assign(0);
+                return result;
+            }
+            radix_type r = unsigned_integer_type::kernel_type::mod_1(&x.container[0], x.container.size(), d);
+            result.unsigned_integer_type::assign(static_cast<unsigned_radix2_type>(r));
+            result.sign = d_sign;
+            return result;
+        }
+
+        int compare_word(unsigned_radix2_type v, bool v_negative) const{
+            bool negative = !sign;
+            if(v == 0){ v_negative = false; }
+            if(negative != v_negative){ return negative ? -1 : 1; }
+            unsigned_radix2_type x;
+            int c = !this->small_value(x) ? 1 : (x < v ? -1 : (x > v ? 1 : 0));
+            return negative ? -c : c;
+        }
+
         template<class Ptr, class Char>
         void read_impl(Ptr str, int zero, int nine, int plus, int minus, const Ptr &delim = Ptr()){
             sign = true;
@@ -730,25 +1370,21 @@ namespace cpp_multi_precision{
         aux::sign sign;
     };
 
-    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator>
-    integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>
+    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator, class T>
+    typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::template enable_if_word<T, integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>>::type
     operator +(
-        typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::radix2_type lhs,
+        T lhs,
         const integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator> &rhs
-    ){
-        integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator> result(lhs);
-        result += rhs;
-        return std::move(result);
-    }
+    ){  return rhs + lhs; }
 
-    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator>
-    integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>
+    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator, class T>
+    typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::template enable_if_word<T, integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>>::type
     operator -(
-        typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::radix2_type lhs,
+        T lhs,
         const integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator> &rhs
     ){
-        integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator> result(lhs);
-        result -= rhs;
+        integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator> result(rhs - lhs);
+        if(result != 0){ result.sign = !result.sign; }
         return std::move(result);
     }
 
@@ -759,12 +1395,12 @@ namespace cpp_multi_precision{
         const integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator> &rhs
     ){  return integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>(lhs) / rhs; }
 
-    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator>
-    integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>
+    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator, class T>
+    typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::template enable_if_word<T, integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>>::type
     operator *(
-        typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::radix2_type lhs,
+        T lhs,
         const integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator> &rhs
-    ){  return integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>(lhs) * rhs; }
+    ){  return rhs * lhs; }
 
     template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator>
     integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>
@@ -773,41 +1409,41 @@ namespace cpp_multi_precision{
         const integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator> &rhs
     ){  return integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>(lhs) % rhs; }
 
-    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator>
-    bool operator <(
-        typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::radix2_type lhs,
+    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator, class T>
+    typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::template enable_if_word<T, bool>::type operator <(
+        T lhs,
         const integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator> &rhs
-    ){  return integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>(lhs) < rhs; }
+    ){  return rhs > lhs; }
 
-    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator>
-    bool operator >(
-        typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::radix2_type lhs,
+    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator, class T>
+    typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::template enable_if_word<T, bool>::type operator >(
+        T lhs,
         const integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator> &rhs
-    ){  return integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>(lhs) > rhs; }
+    ){  return rhs < lhs; }
 
-    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator>
-    bool operator <=(
-        typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::radix2_type lhs,
+    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator, class T>
+    typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::template enable_if_word<T, bool>::type operator <=(
+        T lhs,
         const integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator> &rhs
-    ){  return integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>(lhs) <= rhs; }
+    ){  return rhs >= lhs; }
 
-    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator>
-    bool operator >=(
-        typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::radix2_type lhs,
+    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator, class T>
+    typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::template enable_if_word<T, bool>::type operator >=(
+        T lhs,
         const integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator> &rhs
-    ){  return integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>(lhs) >= rhs; }
+    ){  return rhs <= lhs; }
 
-    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator>
-    bool operator ==(
-        typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::radix2_type lhs,
+    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator, class T>
+    typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::template enable_if_word<T, bool>::type operator ==(
+        T lhs,
         const integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator> &rhs
-    ){  return integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>(lhs) == rhs; }
+    ){  return rhs == lhs; }
 
-    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator>
-    bool operator !=(
-        typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::radix2_type lhs,
+    template<class RadixType, unsigned int RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator, class T>
+    typename integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>::template enable_if_word<T, bool>::type operator !=(
+        T lhs,
         const integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator> &rhs
-    ){  return integer<RadixType, RadixLog2, Radix2Type, URadix2Type, Container, Allocator>(lhs) != rhs; }
+    ){  return rhs != lhs; }
 
     template<class RadixType, std::size_t RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator>
     std::ostream &operator <<(
@@ -0,0 +1,298 @@
+﻿#ifndef HPP_CPP_MULTI_PRECISION_LIMB_KERNEL
+#define HPP_CPP_MULTI_PRECISION_LIMB_KERNEL
+
+#include <cstddef>
+#include <algorithm>
+#include "limb_simd.hpp"
+
+namespace cpp_multi_precision{
+    namespace aux{
+        template<class RadixType, class URadix2Type, std::size_t RadixLog2>
+        struct limb_kernel{
+            typedef RadixType radix_type;
+            typedef URadix2Type unsigned_radix2_type;
+            static const std::size_t radix_log2 = RadixLog2;
+
+            struct function_table{
+                radix_type (*add_n)(radix_type*, const radix_type*, const radix_type*, std::size_t);
+                radix_type (*sub_n)(radix_type*, const radix_type*, const radix_type*, std::size_t);
+                radix_type (*lshift)(radix_type*, const radix_type*, std::size_t, std::size_t);
+                radix_type (*rshift)(radix_type*, const radix_type*, std::size_t, std::size_t);
+                int (*cmp)(const radix_type*, const radix_type*, std::size_t);
+                std::size_t (*normalized_size)(const radix_type*, std::size_t);
+                radix_type (*mul_1)(radix_type*, const radix_type*, std::size_t, radix_type);
+                radix_type (*addmul_1)(radix_type*, const radix_type*, std::size_t, radix_type);
+                radix_type (*submul_1)(radix_type*, const radix_type*, std::size_t, radix_type);
+            };
+
+            static const function_table &functions(){
+                static const function_table table = select_functions();
+                return table;
+            }
+
+            static radix_type add_n(radix_type *r, const radix_type *a, const radix_type *b, std::size_t n){
+                return n < simd_threshold ? add_n_impl<limb_scalar<radix_type>>(r, a, b, n) : functions().add_n(r, a, b, n);
+            }
+
+            static radix_type add_1(radix_type *r, const radix_type *a, std::size_t n, radix_type b){
+                unsigned_radix2_type c = b;
+                for(std::size_t i = 0; i < n; ++i){
+                    c += a[i];
+                    r[i] = static_cast<radix_type>(c);
+                    c >>= radix_log2;
+                }
+                return static_cast<radix_type>(c);
+            }
+
+            static radix_type incr(radix_type *r, std::size_t n, radix_type b){
+                for(std::size_t i = 0; i < n && b != 0; ++i){
+                    r[i] += b;
+                    b = r[i] < b ? 1 : 0;
+                }
+                return b;
+            }
+
+            static radix_type sub_n(radix_type *r, const radix_type *a, const radix_type *b, std::size_t n){
+                return n < simd_threshold ? sub_n_impl<limb_scalar<radix_type>>(r, a, b, n) : functions().sub_n(r, a, b, n);
+            }
+
+            static radix_type sub_1(radix_type *r, const radix_type *a, std::size_t n, radix_type b){
+                radix_type c = b;
+                for(std::size_t i = 0; i < n; ++i){
+                    radix_type x = a[i];
+                    r[i] = x - c;
+                    c = x < c ? 1 : 0;
+                }
+                return c;
+            }
+
+            static radix_type decr(radix_type *r, std::size_t n, radix_type b){
+                for(std::size_t i = 0; i < n && b != 0; ++i){
+                    radix_type x = r[i];
+                    r[i] = x - b;
+                    b = x < b ? 1 : 0;
+                }
+                return b;
+            }
+
+            static int cmp(const radix_type *a, const radix_type *b, std::size_t n){
+                return n < simd_threshold ? cmp_impl<limb_scalar<radix_type>>(a, b, n) : functions().cmp(a, b, n);
+            }
+
+            static std::size_t normalized_size(const radix_type *a, std::size_t n){
+                return n < simd_threshold ? normalized_size_impl<limb_scalar<radix_type>>(a, n) : functions().normalized_size(a, n);
+            }
+
+            static radix_type mul_1(radix_type *r, const radix_type *a, std::size_t n, radix_type b){
+                return functions().mul_1(r, a, n, b);
+            }
+
+            static radix_type addmul_1(radix_type *r, const radix_type *a, std::size_t n, radix_type b){
+                return functions().addmul_1(r, a, n, b);
+            }
+
+            static radix_type submul_1(radix_type *r, const radix_type *a, std::size_t n, radix_type b){
+                return functions().submul_1(r, a, n, b);
+            }
+
+            static radix_type lshift(radix_type *r, const radix_type *a, std::size_t n, std::size_t shift){
+                return n < simd_threshold ? lshift_impl<limb_scalar<radix_type>>(r, a, n, shift) : functions().lshift(r, a, n, shift);
+            }
+
+            static radix_type rshift(radix_type *r, const radix_type *a, std::size_t n, std::size_t shift){
+                return n < simd_threshold ? rshift_impl<limb_scalar<radix_type>>(r, a, n, shift) : functions().rshift(r, a, n, shift);
+            }
+
+            template<class Simd>
+            static radix_type add_n_impl(radix_type *r, const radix_type *a, const radix_type *b, std::size_t n){
+                radix_type s = 0;
+                std::size_t i = n >= simd_threshold ? Simd::add_n(r, a, b, n, s) : 0;
+                unsigned_radix2_type c = s;
+                for(; i < n; ++i){
+                    c += static_cast<unsigned_radix2_type>(a[i]) + b[i];
+                    r[i] = static_cast<radix_type>(c);
+                    c >>= radix_log2;
+                }
+                return static_cast<radix_type>(c);
+            }
+
+            template<class Simd>
+            static radix_type sub_n_impl(radix_type *r, const radix_type *a, const radix_type *b, std::size_t n){
+                radix_type c = 0;
+                for(std::size_t i = n >= simd_threshold ? Simd::sub_n(r, a, b, n, c) : 0; i < n; ++i){
+                    radix_type x = a[i], y = b[i];
+                    r[i] = x - y - c;
+                    c = (x < y || (x == y && c != 0)) ? 1 : 0;
+                }
+                return c;
+            }
+
+            template<class Simd>
+            static int cmp_impl(const radix_type *a, const radix_type *b, std::size_t n){
+                for(std::size_t i = n >= simd_threshold ? Simd::cmp(a, b, n) : n; i > 0; --i){
+                    if(a[i - 1] != b[i - 1]){ return a[i - 1] < b[i - 1] ? -1 : 1; }
+                }
+                return 0;
+            }
+
+            template<class Simd>
+            static std::size_t normalized_size_impl(const radix_type *a, std::size_t n){
+                if(n >= simd_threshold){ n = Simd::normalized_size(a, n); }
+                while(n > 0 && a[n - 1] == 0){ --n; }
+                return n;
+            }
+
+            template<class Mul>
+            static radix_type mul_1_impl(radix_type *r, const radix_type *a, std::size_t n, radix_type b){
+                radix_type s = 0;
+                std::size_t i = Mul::mul_1(r, a, n, b, s);
+                unsigned_radix2_type c = s;
+                for(; i < n; ++i){
+                    c += static_cast<unsigned_radix2_type>(a[i]) * b;
+                    r[i] = static_cast<radix_type>(c);
+                    c >>= radix_log2;
+                }
+                return static_cast<radix_type>(c);
+            }
+
+            template<class Mul>
+            static radix_type addmul_1_impl(radix_type *r, const radix_type *a, std::size_t n, radix_type b){
+                radix_type s = 0;
+                std::size_t i = Mul::addmul_1(r, a, n, b, s);
+                unsigned_radix2_type c = s;
+                for(; i < n; ++i){
+                    c += static_cast<unsigned_radix2_type>(a[i]) * b + r[i];
+                    r[i] = static_cast<radix_type>(c);
+                    c >>= radix_log2;
+                }
+                return static_cast<radix_type>(c);
+            }
+
+            template<class Mul>
+            static radix_type submul_1_impl(radix_type *r, const radix_type *a, std::size_t n, radix_type b){
+                radix_type s = 0;
+                std::size_t i = Mul::submul_1(r, a, n, b, s);
+                unsigned_radix2_type c = s;
+                for(; i < n; ++i){
+                    c += static_cast<unsigned_radix2_type>(a[i]) * b;
+                    radix_type x = r[i], y = static_cast<radix_type>(c);
+                    r[i] = x - y;
+                    c = (c >> radix_log2) + (x < y ? 1 : 0);
+                }
+                return static_cast<radix_type>(c);
+            }
+
+            template<class Simd>
+            static radix_type lshift_impl(radix_type *r, const radix_type *a, std::size_t n, std::size_t shift){
+                if(n == 0){ return 0; }
+                radix_type h = a[n - 1] >> (radix_log2 - shift), c = 0;
+                for(std::size_t i = 0, m = n >= simd_threshold ? Simd::lshift(r, a, n, shift) : n; i < m; ++i){
+                    radix_type x = a[i];
+                    r[i] = (x << shift) | c;
+                    c = x >> (radix_log2 - shift);
+                }
+                return h;
+            }
+
+            template<class Simd>
+            static radix_type rshift_impl(radix_type *r, const radix_type *a, std::size_t n, std::size_t shift){
+                if(n == 0){ return 0; }
+                radix_type l = a[0] << (radix_log2 - shift), c = 0;
+                for(std::size_t i = n, m = n >= simd_threshold ? n - Simd::rshift(r, a, n, shift) : 0; i > m; --i){
+                    radix_type x = a[i - 1];
+                    r[i - 1] = (x >> shift) | c;
+                    c = x << (radix_log2 - shift);
+                }
+                return l;
+            }
+
+            static radix_type divrem_1(radix_type *q, const radix_type *a, std::size_t n, radix_type d){
+                unsigned_radix2_type r = 0;
+                for(std::size_t i = n; i > 0; --i){
+                    r = (r << radix_log2) | a[i - 1];
+                    q[i - 1] = static_cast<radix_type>(r / d);
+                    r %= d;
+                }
+                return static_cast<radix_type>(r);
+            }
+
+            static radix_type mod_1(const radix_type *a, std::size_t n, radix_type d){
+                unsigned_radix2_type r = 0;
+                for(std::size_t i = n; i > 0; --i){
+                    r = ((r << radix_log2) | a[i - 1]) % d;
+                }
+                return static_cast<radix_type>(r);
+            }
+
+            static radix_type binvert(radix_type d){
+                radix_type inv = d;
+                for(std::size_t i = 0; i < 6; ++i){
+                    inv *= static_cast<radix_type>(2) - d * inv;
+                }
+                return inv;
+            }
+
+            static void divexact_1(radix_type *q, const radix_type *a, std::size_t n, radix_type d){
+                radix_type inv = binvert(d), c = 0;
+                for(std::size_t i = 0; i < n; ++i){
+                    radix_type x = a[i], y = x - c;
+                    c = x < c ? 1 : 0;
+                    q[i] = y * inv;
+                    c += static_cast<radix_type>((static_cast<unsigned_radix2_type>(q[i]) * d) >> radix_log2);
+                }
+            }
+
+            static void bdiv_q_basecase(radix_type *q, radix_type *r, std::size_t qn, const radix_type *d, std::size_t dn){
+                radix_type inv = binvert(d[0]);
+                for(std::size_t i = 0; i < qn; ++i){
+                    q[i] = r[i] * inv;
+                    std::size_t n = (std::min)(dn, qn - i);
+                    radix_type c = submul_1(r + i, d, n, q[i]);
+                    if(i + n < qn){ decr(r + i + n, qn - i - n, c); }
+                }
+            }
+
+            static void mul_basecase(radix_type *r, const radix_type *a, std::size_t an, const radix_type *b, std::size_t bn){
+                r[an] = mul_1(r, a, an, b[0]);
+                for(std::size_t j = 1; j < bn; ++j){
+                    r[an + j] = addmul_1(r + j, a, an, b[j]);
+                }
+            }
+
+            static void sqr_basecase(radix_type *r, const radix_type *a, std::size_t n){
+                std::fill(r, r + n * 2, static_cast<radix_type>(0));
+                for(std::size_t i = 0; i + 1 < n; ++i){
+                    r[i + n] = addmul_1(r + (i * 2 + 1), a + (i + 1), n - i - 1, a[i]);
+                }
+                lshift(r, r, n * 2, 1);
+                unsigned_radix2_type c = 0;
+                for(std::size_t i = 0; i < n; ++i){
+                    unsigned_radix2_type t = static_cast<unsigned_radix2_type>(a[i]) * a[i];
+                    c += static_cast<unsigned_radix2_type>(r[i * 2]) + static_cast<radix_type>(t);
+                    r[i * 2] = static_cast<radix_type>(c);
+                    c >>= radix_log2;
+                    c += static_cast<unsigned_radix2_type>(r[i * 2 + 1]) + (t >> radix_log2);
+                    r[i * 2 + 1] = static_cast<radix_type>(c);
+                    c >>= radix_log2;
+                }
+            }
+
+        protected:
+            static const std::size_t simd_threshold = 16;
+
+        private:
+            static function_table select_functions(){
+                typedef limb_scalar<radix_type> scalar;
+                function_table t = {
+                    &add_n_impl<scalar>, &sub_n_impl<scalar>, &lshift_impl<scalar>, &rshift_impl<scalar>,
+                    &cmp_impl<scalar>, &normalized_size_impl<scalar>,
+                    &mul_1_impl<scalar>, &addmul_1_impl<scalar>, &submul_1_impl<scalar>
+                };
+                limb_dispatch<radix_type, radix_log2>::template bind<limb_kernel>(t);
+                return t;
+            }
+        };
+    }
+}
+
+#endif
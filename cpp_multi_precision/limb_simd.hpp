@@ -0,0 +1,435 @@
+﻿#ifndef HPP_CPP_MULTI_PRECISION_LIMB_SIMD
+#define HPP_CPP_MULTI_PRECISION_LIMB_SIMD
+
+#include <cstddef>
+#include "cpu_features.hpp"
+
+#ifdef CPP_MULTI_PRECISION_SIMD_X86
+#include <immintrin.h>
+#define CPP_MULTI_PRECISION_TARGET_AVX2 __attribute__((target("avx2")))
+#define CPP_MULTI_PRECISION_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+namespace cpp_multi_precision{
+    namespace aux{
+        template<class RadixType>
+        struct limb_scalar{
+            typedef RadixType radix_type;
+
+            static std::size_t add_n(radix_type*, const radix_type*, const radix_type*, std::size_t, radix_type&){ return 0; }
+            static std::size_t sub_n(radix_type*, const radix_type*, const radix_type*, std::size_t, radix_type&){ return 0; }
+            static std::size_t lshift(radix_type*, const radix_type*, std::size_t n, std::size_t){ return n; }
+            static std::size_t rshift(radix_type*, const radix_type*, std::size_t n, std::size_t){ return n; }
+            static std::size_t cmp(const radix_type*, const radix_type*, std::size_t n){ return n; }
+            static std::size_t normalized_size(const radix_type*, std::size_t n){ return n; }
+            static std::size_t mul_1(radix_type*, const radix_type*, std::size_t, radix_type, radix_type&){ return 0; }
+            static std::size_t addmul_1(radix_type*, const radix_type*, std::size_t, radix_type, radix_type&){ return 0; }
+            static std::size_t submul_1(radix_type*, const radix_type*, std::size_t, radix_type, radix_type&){ return 0; }
+        };
+
+        template<class RadixType, std::size_t RadixLog2, bool = sizeof(RadixType) * 8 == RadixLog2>
+        struct limb_dispatch{
+            template<class Kernel, class Table>
+            static void bind(Table&){}
+        };
+
+#ifdef CPP_MULTI_PRECISION_SIMD_X86
+        template<std::size_t LaneLog2>
+        struct avx2_lane;
+
+        template<>
+        struct avx2_lane<32>{
+            static const std::size_t width = 8;
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i add(__m256i x, __m256i y){ return _mm256_add_epi32(x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i sub(__m256i x, __m256i y){ return _mm256_sub_epi32(x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i eq(__m256i x, __m256i y){ return _mm256_cmpeq_epi32(x, y); }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i lt(__m256i x, __m256i y){
+                const __m256i s = _mm256_set1_epi32(static_cast<int>(0x80000000u));
+                return _mm256_cmpgt_epi32(_mm256_xor_si256(y, s), _mm256_xor_si256(x, s));
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static unsigned int bits(__m256i x){ return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(x))); }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i expand(unsigned int m){
+                const __m256i b = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+                return _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int>(m)), b), b);
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i sll(__m256i x, __m128i c){ return _mm256_sll_epi32(x, c); }
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i srl(__m256i x, __m128i c){ return _mm256_srl_epi32(x, c); }
+        };
+
+        template<>
+        struct avx2_lane<64>{
+            static const std::size_t width = 4;
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i add(__m256i x, __m256i y){ return _mm256_add_epi64(x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i sub(__m256i x, __m256i y){ return _mm256_sub_epi64(x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i eq(__m256i x, __m256i y){ return _mm256_cmpeq_epi64(x, y); }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i lt(__m256i x, __m256i y){
+                const __m256i s = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ull));
+                return _mm256_cmpgt_epi64(_mm256_xor_si256(y, s), _mm256_xor_si256(x, s));
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static unsigned int bits(__m256i x){ return static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(x))); }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i expand(unsigned int m){
+                const __m256i b = _mm256_setr_epi64x(1, 2, 4, 8);
+                return _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(m), b), b);
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i sll(__m256i x, __m128i c){ return _mm256_sll_epi64(x, c); }
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i srl(__m256i x, __m128i c){ return _mm256_srl_epi64(x, c); }
+        };
+
+        template<class RadixType, std::size_t RadixLog2>
+        struct limb_avx2{
+            typedef RadixType radix_type;
+            typedef avx2_lane<RadixLog2> lane;
+            static const std::size_t width = lane::width;
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i load(const radix_type *p){ return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+            CPP_MULTI_PRECISION_TARGET_AVX2 static void store(radix_type *p, __m256i x){ _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), x); }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static std::size_t add_n(radix_type *r, const radix_type *a, const radix_type *b, std::size_t n, radix_type &c){
+                const __m256i ones = _mm256_set1_epi32(-1);
+                unsigned int cy = static_cast<unsigned int>(c);
+                std::size_t i = 0;
+                for(; i + width <= n; i += width){
+                    __m256i x = load(a + i), s = lane::add(x, load(b + i));
+                    unsigned int g = lane::bits(lane::lt(s, x)), p = lane::bits(lane::eq(s, ones)), t = (g << 1) + p + cy;
+                    store(r + i, lane::sub(s, lane::expand(t ^ p)));
+                    cy = t >> width;
+                }
+                c = static_cast<radix_type>(cy);
+                return i;
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static std::size_t sub_n(radix_type *r, const radix_type *a, const radix_type *b, std::size_t n, radix_type &c){
+                const __m256i zero = _mm256_setzero_si256();
+                unsigned int cy = static_cast<unsigned int>(c);
+                std::size_t i = 0;
+                for(; i + width <= n; i += width){
+                    __m256i x = load(a + i), y = load(b + i), d = lane::sub(x, y);
+                    unsigned int g = lane::bits(lane::lt(x, y)), p = lane::bits(lane::eq(d, zero)), t = (g << 1) + p + cy;
+                    store(r + i, lane::add(d, lane::expand(t ^ p)));
+                    cy = t >> width;
+                }
+                c = static_cast<radix_type>(cy);
+                return i;
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static std::size_t lshift(radix_type *r, const radix_type *a, std::size_t n, std::size_t shift){
+                __m128i sl = _mm_cvtsi32_si128(static_cast<int>(shift)), sr = _mm_cvtsi32_si128(static_cast<int>(RadixLog2 - shift));
+                std::size_t i = n;
+                for(; i > width; i -= width){
+                    std::size_t j = i - width;
+                    store(r + j, _mm256_or_si256(lane::sll(load(a + j), sl), lane::srl(load(a + (j - 1)), sr)));
+                }
+                return i;
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static std::size_t rshift(radix_type *r, const radix_type *a, std::size_t n, std::size_t shift){
+                __m128i sr = _mm_cvtsi32_si128(static_cast<int>(shift)), sl = _mm_cvtsi32_si128(static_cast<int>(RadixLog2 - shift));
+                std::size_t i = 0;
+                for(; i + width < n; i += width){
+                    store(r + i, _mm256_or_si256(lane::srl(load(a + i), sr), lane::sll(load(a + (i + 1)), sl)));
+                }
+                return n - i;
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static std::size_t cmp(const radix_type *a, const radix_type *b, std::size_t n){
+                std::size_t i = n;
+                for(; i >= width; i -= width){
+                    if(lane::bits(lane::eq(load(a + (i - width)), load(b + (i - width)))) != (1u << width) - 1){ break; }
+                }
+                return i;
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static std::size_t normalized_size(const radix_type *a, std::size_t n){
+                std::size_t i = n;
+                for(; i >= width; i -= width){
+                    __m256i x = load(a + (i - width));
+                    if(!_mm256_testz_si256(x, x)){ break; }
+                }
+                return i;
+            }
+        };
+
+        template<std::size_t LaneLog2>
+        struct avx512_lane;
+
+        template<>
+        struct avx512_lane<32>{
+            static const std::size_t width = 16;
+
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i add(__m512i x, __m512i y){ return _mm512_add_epi32(x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i sub(__m512i x, __m512i y){ return _mm512_sub_epi32(x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i mask_add(__m512i x, unsigned int m, __m512i y){ return _mm512_mask_add_epi32(x, static_cast<__mmask16>(m), x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i mask_sub(__m512i x, unsigned int m, __m512i y){ return _mm512_mask_sub_epi32(x, static_cast<__mmask16>(m), x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static unsigned int eq(__m512i x, __m512i y){ return _mm512_cmpeq_epi32_mask(x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static unsigned int lt(__m512i x, __m512i y){ return _mm512_cmplt_epu32_mask(x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static unsigned int nonzero(__m512i x){ return _mm512_test_epi32_mask(x, x); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i sll(__m512i x, __m128i c){ return _mm512_sll_epi32(x, c); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i srl(__m512i x, __m128i c){ return _mm512_srl_epi32(x, c); }
+        };
+
+        template<>
+        struct avx512_lane<64>{
+            static const std::size_t width = 8;
+
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i add(__m512i x, __m512i y){ return _mm512_add_epi64(x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i sub(__m512i x, __m512i y){ return _mm512_sub_epi64(x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i mask_add(__m512i x, unsigned int m, __m512i y){ return _mm512_mask_add_epi64(x, static_cast<__mmask8>(m), x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i mask_sub(__m512i x, unsigned int m, __m512i y){ return _mm512_mask_sub_epi64(x, static_cast<__mmask8>(m), x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static unsigned int eq(__m512i x, __m512i y){ return _mm512_cmpeq_epi64_mask(x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static unsigned int lt(__m512i x, __m512i y){ return _mm512_cmplt_epu64_mask(x, y); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static unsigned int nonzero(__m512i x){ return _mm512_test_epi64_mask(x, x); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i sll(__m512i x, __m128i c){ return _mm512_sll_epi64(x, c); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i srl(__m512i x, __m128i c){ return _mm512_srl_epi64(x, c); }
+        };
+
+        template<class RadixType, std::size_t RadixLog2>
+        struct limb_avx512{
+            typedef RadixType radix_type;
+            typedef avx512_lane<RadixLog2> lane;
+            static const std::size_t width = lane::width;
+
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i load(const radix_type *p){ return _mm512_loadu_si512(p); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static void store(radix_type *p, __m512i x){ _mm512_storeu_si512(p, x); }
+
+            CPP_MULTI_PRECISION_TARGET_AVX512 static std::size_t add_n(radix_type *r, const radix_type *a, const radix_type *b, std::size_t n, radix_type &c){
+                const __m512i ones = _mm512_set1_epi32(-1);
+                unsigned int cy = static_cast<unsigned int>(c);
+                std::size_t i = 0;
+                for(; i + width <= n; i += width){
+                    __m512i x = load(a + i), s = lane::add(x, load(b + i));
+                    unsigned int g = lane::lt(s, x), p = lane::eq(s, ones), t = (g << 1) + p + cy;
+                    store(r + i, lane::mask_sub(s, t ^ p, ones));
+                    cy = t >> width;
+                }
+                c = static_cast<radix_type>(cy);
+                return i;
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX512 static std::size_t sub_n(radix_type *r, const radix_type *a, const radix_type *b, std::size_t n, radix_type &c){
+                const __m512i ones = _mm512_set1_epi32(-1);
+                unsigned int cy = static_cast<unsigned int>(c);
+                std::size_t i = 0;
+                for(; i + width <= n; i += width){
+                    __m512i x = load(a + i), y = load(b + i), d = lane::sub(x, y);
+                    unsigned int g = lane::lt(x, y), p = lane::eq(x, y), t = (g << 1) + p + cy;
+                    store(r + i, lane::mask_add(d, t ^ p, ones));
+                    cy = t >> width;
+                }
+                c = static_cast<radix_type>(cy);
+                return i;
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX512 static std::size_t lshift(radix_type *r, const radix_type *a, std::size_t n, std::size_t shift){
+                __m128i sl = _mm_cvtsi32_si128(static_cast<int>(shift)), sr = _mm_cvtsi32_si128(static_cast<int>(RadixLog2 - shift));
+                std::size_t i = n;
+                for(; i > width; i -= width){
+                    std::size_t j = i - width;
+                    store(r + j, _mm512_or_si512(lane::sll(load(a + j), sl), lane::srl(load(a + (j - 1)), sr)));
+                }
+                return i;
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX512 static std::size_t rshift(radix_type *r, const radix_type *a, std::size_t n, std::size_t shift){
+                __m128i sr = _mm_cvtsi32_si128(static_cast<int>(shift)), sl = _mm_cvtsi32_si128(static_cast<int>(RadixLog2 - shift));
+                std::size_t i = 0;
+                for(; i + width < n; i += width){
+                    store(r + i, _mm512_or_si512(lane::srl(load(a + i), sr), lane::sll(load(a + (i + 1)), sl)));
+                }
+                return n - i;
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX512 static std::size_t cmp(const radix_type *a, const radix_type *b, std::size_t n){
+                std::size_t i = n;
+                for(; i >= width; i -= width){
+                    if(lane::eq(load(a + (i - width)), load(b + (i - width))) != (1u << width) - 1){ break; }
+                }
+                return i;
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX512 static std::size_t normalized_size(const radix_type *a, std::size_t n){
+                std::size_t i = n;
+                for(; i >= width; i -= width){
+                    if(lane::nonzero(load(a + (i - width))) != 0){ break; }
+                }
+                return i;
+            }
+        };
+
+        template<class RadixType, std::size_t RadixLog2, bool = RadixLog2 == 64 && sizeof(void*) == 8>
+        struct limb_mulx{
+            template<class Kernel, class Table>
+            static void bind(Table&, const cpu_features&){}
+        };
+
+        template<class RadixType, std::size_t RadixLog2>
+        struct limb_mulx<RadixType, RadixLog2, true>{
+            typedef RadixType radix_type;
+
+            template<class Kernel, class Table>
+            static void bind(Table &t, const cpu_features &f){
+                if(f.bmi2 && f.adx){
+                    t.mul_1 = &Kernel::template mul_1_impl<limb_mulx>;
+                    t.addmul_1 = &Kernel::template addmul_1_impl<limb_mulx>;
+                    t.submul_1 = &Kernel::template submul_1_impl<limb_mulx>;
+                }
+            }
+
+            static std::size_t mul_1(radix_type *r, const radix_type *a, std::size_t n, radix_type b, radix_type &c){
+                std::size_t k = n / 4;
+                if(k == 0){ return 0; }
+                radix_type x = c;
+                __asm__ __volatile__(
+                    "xorl %%r8d, %%r8d\n"
+                    "1:\n"
+                    "mulx (%[a]), %%r8, %%r9\n"
+                    "adcx %[x], %%r8\n"
+                    "mov %%r8, (%[r])\n"
+                    "mulx 8(%[a]), %%r8, %[x]\n"
+                    "adcx %%r9, %%r8\n"
+                    "mov %%r8, 8(%[r])\n"
+                    "mulx 16(%[a]), %%r8, %%r9\n"
+                    "adcx %[x], %%r8\n"
+                    "mov %%r8, 16(%[r])\n"
+                    "mulx 24(%[a]), %%r8, %[x]\n"
+                    "adcx %%r9, %%r8\n"
+                    "mov %%r8, 24(%[r])\n"
+                    "lea 32(%[a]), %[a]\n"
+                    "lea 32(%[r]), %[r]\n"
+                    "lea -1(%[k]), %[k]\n"
+                    "jrcxz 2f\n"
+                    "jmp 1b\n"
+                    "2:\n"
+                    "movl $0, %%r8d\n"
+                    "adcx %%r8, %[x]\n"
+                    : [r] "+r"(r), [a] "+r"(a), [k] "+c"(k), [x] "+r"(x)
+                    : "d"(b)
+                    : "r8", "r9", "cc", "memory"
+                );
+                c = x;
+                return n & ~static_cast<std::size_t>(3);
+            }
+
+            static std::size_t addmul_1(radix_type *r, const radix_type *a, std::size_t n, radix_type b, radix_type &c){
+                std::size_t k = n / 4;
+                if(k == 0){ return 0; }
+                radix_type x = c;
+                __asm__ __volatile__(
+                    "xorl %%r8d, %%r8d\n"
+                    "1:\n"
+                    "mulx (%[a]), %%r8, %%r9\n"
+                    "adcx %[x], %%r8\n"
+                    "adox (%[r]), %%r8\n"
+                    "mov %%r8, (%[r])\n"
+                    "mulx 8(%[a]), %%r8, %[x]\n"
+                    "adcx %%r9, %%r8\n"
+                    "adox 8(%[r]), %%r8\n"
+                    "mov %%r8, 8(%[r])\n"
+                    "mulx 16(%[a]), %%r8, %%r9\n"
+                    "adcx %[x], %%r8\n"
+                    "adox 16(%[r]), %%r8\n"
+                    "mov %%r8, 16(%[r])\n"
+                    "mulx 24(%[a]), %%r8, %[x]\n"
+                    "adcx %%r9, %%r8\n"
+                    "adox 24(%[r]), %%r8\n"
+                    "mov %%r8, 24(%[r])\n"
+                    "lea 32(%[a]), %[a]\n"
+                    "lea 32(%[r]), %[r]\n"
+                    "lea -1(%[k]), %[k]\n"
+                    "jrcxz 2f\n"
+                    "jmp 1b\n"
+                    "2:\n"
+                    "movl $0, %%r8d\n"
+                    "adcx %%r8, %[x]\n"
+                    "adox %%r8, %[x]\n"
+                    : [r] "+r"(r), [a] "+r"(a), [k] "+c"(k), [x] "+r"(x)
+                    : "d"(b)
+                    : "r8", "r9", "cc", "memory"
+                );
+                c = x;
+                return n & ~static_cast<std::size_t>(3);
+            }
+
+            static std::size_t submul_1(radix_type *r, const radix_type *a, std::size_t n, radix_type b, radix_type &c){
+                std::size_t k = n / 4;
+                if(k == 0){ return 0; }
+                radix_type x = c;
+                __asm__ __volatile__(
+                    "movabs $0x7fffffffffffffff, %%r8\n"
+                    "add $1, %%r8\n"
+                    "1:\n"
+                    "mulx (%[a]), %%r8, %%r9\n"
+                    "adcx %[x], %%r8\n"
+                    "not %%r8\n"
+                    "adox (%[r]), %%r8\n"
+                    "mov %%r8, (%[r])\n"
+                    "mulx 8(%[a]), %%r8, %[x]\n"
+                    "adcx %%r9, %%r8\n"
+                    "not %%r8\n"
+                    "adox 8(%[r]), %%r8\n"
+                    "mov %%r8, 8(%[r])\n"
+                    "mulx 16(%[a]), %%r8, %%r9\n"
+                    "adcx %[x], %%r8\n"
+                    "not %%r8\n"
+                    "adox 16(%[r]), %%r8\n"
+                    "mov %%r8, 16(%[r])\n"
+                    "mulx 24(%[a]), %%r8, %[x]\n"
+                    "adcx %%r9, %%r8\n"
+                    "not %%r8\n"
+                    "adox 24(%[r]), %%r8\n"
+                    "mov %%r8, 24(%[r])\n"
+                    "lea 32(%[a]), %[a]\n"
+                    "lea 32(%[r]), %[r]\n"
+                    "lea -1(%[k]), %[k]\n"
+                    "jrcxz 2f\n"
+                    "jmp 1b\n"
+                    "2:\n"
+                    "movl $0, %%r8d\n"
+                    "adcx %%r8, %[x]\n"
+                    "seto %%r8b\n"
+                    "sub %%r8, %[x]\n"
+                    "lea 1(%[x]), %[x]\n"
+                    : [r] "+r"(r), [a] "+r"(a), [k] "+c"(k), [x] "+r"(x)
+                    : "d"(b)
+                    : "r8", "r9", "cc", "memory"
+                );
+                c = x;
+                return n & ~static_cast<std::size_t>(3);
+            }
+        };
+
+        template<class RadixType, std::size_t RadixLog2>
+        struct limb_dispatch<RadixType, RadixLog2, true>{
+            template<class Kernel, class Table>
+            static void bind(Table &t){
+                const cpu_features &f = cpu_features::get();
+                if(f.avx512f){ bind_simd<Kernel, limb_avx512<RadixType, RadixLog2>>(t); }
+                else if(f.avx2){ bind_simd<Kernel, limb_avx2<RadixType, RadixLog2>>(t); }
+                limb_mulx<RadixType, RadixLog2>::template bind<Kernel>(t, f);
+            }
+
+        private:
+            template<class Kernel, class Simd, class Table>
+            static void bind_simd(Table &t){
+                t.add_n = &Kernel::template add_n_impl<Simd>;
+                t.sub_n = &Kernel::template sub_n_impl<Simd>;
+                t.lshift = &Kernel::template lshift_impl<Simd>;
+                t.rshift = &Kernel::template rshift_impl<Simd>;
+                t.cmp = &Kernel::template cmp_impl<Simd>;
+                t.normalized_size = &Kernel::template normalized_size_impl<Simd>;
+            }
+        };
+#endif
+    }
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include <string>
 #include <ostream>
 #include <queue>
+#include <deque>
 #include <vector>
 #include <algorithm>
 #include <utility>
@@ -13,7 +14,15 @@
 #include <cmath>
 #include <cassert>
 #include <climits>
+#include <mutex>
 #include <boost/utility/enable_if.hpp>
+#include "ntt_simd.hpp"
+
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define CPP_MULTI_PRECISION_NOEXCEPT throw()
+#else
+#define CPP_MULTI_PRECISION_NOEXCEPT noexcept
+#endif
 
 namespace cpp_multi_precision{
     namespace aux{
@@ -150,6 +159,44 @@ namespace cpp_multi_precision{
             return multi_dispatch_2(result, lhs, rhs);
         }
 
+        CPP_MULTI_PRECISION_AUX_HAS_MEM_FN(addmul, CPP_MULTI_PRECISION_AUX_SIGNATURE_MULTI);
+        CPP_MULTI_PRECISION_AUX_HAS_MEM_FN(submul, CPP_MULTI_PRECISION_AUX_SIGNATURE_MULTI);
+
+        template<class T>
+        T &addmul_dispatch(T &acc, const T &a, const T &b, typename boost::enable_if<has_addmul<T>>::type* = 0){
+            return T::addmul(acc, a, b);
+        }
+
+        template<class T>
+        T &addmul_dispatch(T &acc, const T &a, const T &b, typename boost::disable_if<has_addmul<T>>::type* = 0){
+            acc += a * b;
+            return acc;
+        }
+
+        template<class T>
+        T &submul_dispatch(T &acc, const T &a, const T &b, typename boost::enable_if<has_submul<T>>::type* = 0){
+            return T::submul(acc, a, b);
+        }
+
+        template<class T>
+        T &submul_dispatch(T &acc, const T &a, const T &b, typename boost::disable_if<has_submul<T>>::type* = 0){
+            acc -= a * b;
+            return acc;
+        }
+
+        CPP_MULTI_PRECISION_AUX_HAS_MEM_FN(divexact, CPP_MULTI_PRECISION_AUX_SIGNATURE_MULTI);
+
+        template<class T>
+        T &divexact_dispatch(T &result, const T &lhs, const T &rhs, typename boost::enable_if<has_divexact<T>>::type* = 0){
+            return T::divexact(result, lhs, rhs);
+        }
+
+        template<class T>
+        T &divexact_dispatch(T &result, const T &lhs, const T &rhs, typename boost::disable_if<has_divexact<T>>::type* = 0){
+            result = lhs / rhs;
+            return result;
+        }
+
         template<class Ptr, class Char>
         Ptr reading_str_rbegin(Ptr str, Char zero, Char nine, Ptr delim){
             for(; str != delim && *str >= zero && *str <= nine; ++str);
@@ -473,6 +520,182 @@ namespace cpp_multi_precision{
             }
         };
 
+        template<class Type, Type Mod, std::size_t I = 5>
+        struct ntt_montgomery_inverse{
+            static const Type prev = ntt_montgomery_inverse<Type, Mod, I - 1>::value;
+            static const Type value = prev * (2 - Mod * prev);
+        };
+
+        template<class Type, Type Mod>
+        struct ntt_montgomery_inverse<Type, Mod, 0>{
+            static const Type value = Mod;
+        };
+
+        template<class Type, class Type2, Type Mod, bool = sizeof(Type2) == sizeof(Type) * 2>
+        struct ntt_modmul{
+            static Type mul(Type a, Type b){
+                return static_cast<Type>(static_cast<Type2>(a) * b % Mod);
+            }
+
+            static Type to_root(Type a){
+                return a;
+            }
+
+            static Type mul_root(Type a, Type w){
+                return mul(a, w);
+            }
+        };
+
+        template<class Type, class Type2, Type Mod>
+        struct ntt_modmul<Type, Type2, Mod, true>{
+            static const Type inv = static_cast<Type>(0) - ntt_montgomery_inverse<Type, Mod>::value;
+            static const Type r2 = static_cast<Type>((static_cast<Type2>(0) - Mod) % Mod);
+
+            static Type mul(Type a, Type b){
+                return redc(static_cast<Type2>(redc(static_cast<Type2>(a) * b)) * r2);
+            }
+
+            static Type to_root(Type a){
+                return redc(static_cast<Type2>(a) * r2);
+            }
+
+            static Type mul_root(Type a, Type w){
+                return redc(static_cast<Type2>(a) * w);
+            }
+
+        private:
+            static Type redc(Type2 t){
+                Type m = static_cast<Type>(t) * inv;
+                Type r = static_cast<Type>((t + static_cast<Type2>(m) * Mod) >> (sizeof(Type) * 8));
+                return r >= Mod ? r - Mod : r;
+            }
+        };
+
+        template<class Type, class Type2, Type Mod, Type PrimitiveRoot>
+        struct ntt_prime{
+            typedef Type value_type;
+            typedef Type2 value2_type;
+            typedef ntt_modmul<Type, Type2, Mod> modmul;
+            static const value_type mod = Mod;
+
+            static value_type add(value_type a, value_type b){
+                value_type c = a + b;
+                return c >= Mod ? c - Mod : c;
+            }
+
+            static value_type sub(value_type a, value_type b){
+                return a >= b ? a - b : a + (Mod - b);
+            }
+
+            static value_type mul(value_type a, value_type b){
+                return modmul::mul(a, b);
+            }
+
+            static value_type pow(value_type a, value_type e){
+                value_type r = 1;
+                for(; e > 0; e >>= 1, a = mul(a, a)){
+                    if((e & 1) == 1){ r = mul(r, a); }
+                }
+                return r;
+            }
+
+            static value_type inverse(value_type a){
+                return pow(a, Mod - 2);
+            }
+
+            struct function_table{
+                void (*forward_stage)(value_type*, std::size_t, std::size_t, const value_type*);
+                void (*inverse_stage)(value_type*, std::size_t, std::size_t, const value_type*);
+            };
+
+            static const function_table &functions(){
+                static const function_table table = select_functions();
+                return table;
+            }
+
+            template<class Vector>
+            static void transform(value_type *a, std::size_t n, Vector &w){
+                const function_table &f = functions();
+                for(std::size_t m = n; m >= 2; m >>= 1){
+                    root_table(w, m / 2, pow(PrimitiveRoot, (Mod - 1) / m));
+                    f.forward_stage(a, n, m, &w[0]);
+                }
+            }
+
+            template<class Vector>
+            static void inverse_transform(value_type *a, std::size_t n, Vector &w){
+                const function_table &f = functions();
+                for(std::size_t m = 2; m <= n; m <<= 1){
+                    root_table(w, m / 2, inverse(pow(PrimitiveRoot, (Mod - 1) / m)));
+                    f.inverse_stage(a, n, m, &w[0]);
+                }
+                value_type inv_n = inverse(static_cast<value_type>(n % Mod));
+                for(std::size_t i = 0; i < n; ++i){
+                    a[i] = mul(a[i], inv_n);
+                }
+            }
+
+            static void forward_stage(value_type *a, std::size_t n, std::size_t m, const value_type *w){
+                std::size_t h = m / 2;
+                for(std::size_t i = 0; i < n; i += m){
+                    value_type *p = a + i, *q = p + h;
+                    for(std::size_t j = 0; j < h; ++j){
+                        value_type u = p[j], v = q[j];
+                        p[j] = add(u, v);
+                        q[j] = modmul::mul_root(sub(u, v), w[j]);
+                    }
+                }
+            }
+
+            static void inverse_stage(value_type *a, std::size_t n, std::size_t m, const value_type *w){
+                std::size_t h = m / 2;
+                for(std::size_t i = 0; i < n; i += m){
+                    value_type *p = a + i, *q = p + h;
+                    for(std::size_t j = 0; j < h; ++j){
+                        value_type u = p[j], v = modmul::mul_root(q[j], w[j]);
+                        p[j] = add(u, v);
+                        q[j] = sub(u, v);
+                    }
+                }
+            }
+
+        private:
+            static function_table select_functions(){
+                function_table t = { &forward_stage, &inverse_stage };
+                ntt_dispatch<ntt_prime>::bind(t);
+                return t;
+            }
+
+            template<class Vector>
+            static void root_table(Vector &w, std::size_t h, value_type root){
+                w.resize(h);
+                w[0] = modmul::to_root(1);
+                root = modmul::to_root(root);
+                for(std::size_t j = 1; j < h; ++j){
+                    w[j] = modmul::mul_root(w[j - 1], root);
+                }
+            }
+        };
+
+        template<class Type, class Type2, std::size_t N = sizeof(Type) * 8>
+        struct ntt_prime_set;
+
+        template<class Type, class Type2>
+        struct ntt_prime_set<Type, Type2, 32>{
+            typedef ntt_prime<Type, Type2, 2013265921, 31> prime1_type;
+            typedef ntt_prime<Type, Type2, 469762049, 3> prime2_type;
+            typedef ntt_prime<Type, Type2, 754974721, 11> prime3_type;
+            static const std::size_t max_log2 = 24;
+        };
+
+        template<class Type, class Type2>
+        struct ntt_prime_set<Type, Type2, 64>{
+            typedef ntt_prime<Type, Type2, 4179340454199820289ULL, 3> prime1_type;
+            typedef ntt_prime<Type, Type2, 2485986994308513793ULL, 5> prime2_type;
+            typedef ntt_prime<Type, Type2, 2936346957045563393ULL, 3> prime3_type;
+            static const std::size_t max_log2 = 30;
+        };
+
         template<class T>
         T gcd_impl(T a, T b){
             if(b == 1){ return b; }
@@ -505,13 +728,10 @@ namespace cpp_multi_precision{
             while(r_1 != 0){
                 T &q(result);
                 q = r_0 / r_1;
-                T r_m = r_1, s_m = s_1, t_m = t_1;
-                r_1 = r_0 - q * r_1;
-                s_1 = s_0 - q * s_1;
-                t_1 = t_0 - q * t_1;
-                r_0 = std::move(r_m);
-                s_0 = std::move(s_m);
-                t_0 = std::move(t_m);
+                std::swap(r_0, r_1), std::swap(s_0, s_1), std::swap(t_0, t_1);
+                submul_dispatch(r_1, q, r_0);
+                submul_dispatch(s_1, q, s_0);
+                submul_dispatch(t_1, q, t_0);
             }
             s = std::move(s_0);
             t = std::move(t_0);
@@ -0,0 +1,156 @@
+﻿#ifndef HPP_CPP_MULTI_PRECISION_NTT_SIMD
+#define HPP_CPP_MULTI_PRECISION_NTT_SIMD
+
+#include <cstddef>
+#include "limb_simd.hpp"
+
+namespace cpp_multi_precision{
+    namespace aux{
+        template<class Prime, bool = sizeof(typename Prime::value_type) == 4 && sizeof(typename Prime::value2_type) == 8>
+        struct ntt_dispatch{
+            template<class Table>
+            static void bind(Table&){}
+        };
+
+#ifdef CPP_MULTI_PRECISION_SIMD_X86
+        template<class Prime>
+        struct ntt_avx2{
+            typedef typename Prime::value_type value_type;
+            static const std::size_t width = 8;
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i load(const value_type *p){ return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+            CPP_MULTI_PRECISION_TARGET_AVX2 static void store(value_type *p, __m256i x){ _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), x); }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i add(__m256i x, __m256i y, __m256i p){
+                __m256i c = _mm256_add_epi32(x, y);
+                return _mm256_min_epu32(c, _mm256_sub_epi32(c, p));
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i sub(__m256i x, __m256i y, __m256i p){
+                __m256i d = _mm256_sub_epi32(x, y);
+                return _mm256_min_epu32(d, _mm256_add_epi32(d, p));
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static __m256i mul_root(__m256i x, __m256i w, __m256i p, __m256i inv){
+                __m256i e = _mm256_mul_epu32(x, w), o = _mm256_mul_epu32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(w, 32));
+                e = _mm256_add_epi64(e, _mm256_mul_epu32(_mm256_mul_epu32(e, inv), p));
+                o = _mm256_add_epi64(o, _mm256_mul_epu32(_mm256_mul_epu32(o, inv), p));
+                __m256i r = _mm256_blend_epi32(_mm256_srli_epi64(e, 32), o, 0xaa);
+                return _mm256_min_epu32(r, _mm256_sub_epi32(r, p));
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static void forward_stage(value_type *a, std::size_t n, std::size_t m, const value_type *w){
+                std::size_t h = m / 2;
+                if(h < width){
+                    Prime::forward_stage(a, n, m, w);
+                    return;
+                }
+                const __m256i p = _mm256_set1_epi32(static_cast<int>(Prime::mod)), inv = _mm256_set1_epi32(static_cast<int>(Prime::modmul::inv));
+                for(std::size_t i = 0; i < n; i += m){
+                    value_type *s = a + i, *t = s + h;
+                    for(std::size_t j = 0; j < h; j += width){
+                        __m256i u = load(s + j), v = load(t + j);
+                        store(s + j, add(u, v, p));
+                        store(t + j, mul_root(sub(u, v, p), load(w + j), p, inv));
+                    }
+                }
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX2 static void inverse_stage(value_type *a, std::size_t n, std::size_t m, const value_type *w){
+                std::size_t h = m / 2;
+                if(h < width){
+                    Prime::inverse_stage(a, n, m, w);
+                    return;
+                }
+                const __m256i p = _mm256_set1_epi32(static_cast<int>(Prime::mod)), inv = _mm256_set1_epi32(static_cast<int>(Prime::modmul::inv));
+                for(std::size_t i = 0; i < n; i += m){
+                    value_type *s = a + i, *t = s + h;
+                    for(std::size_t j = 0; j < h; j += width){
+                        __m256i u = load(s + j), v = mul_root(load(t + j), load(w + j), p, inv);
+                        store(s + j, add(u, v, p));
+                        store(t + j, sub(u, v, p));
+                    }
+                }
+            }
+        };
+
+        template<class Prime>
+        struct ntt_avx512{
+            typedef typename Prime::value_type value_type;
+            static const std::size_t width = 16;
+
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i load(const value_type *p){ return _mm512_loadu_si512(p); }
+            CPP_MULTI_PRECISION_TARGET_AVX512 static void store(value_type *p, __m512i x){ _mm512_storeu_si512(p, x); }
+
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i add(__m512i x, __m512i y, __m512i p){
+                __m512i c = _mm512_add_epi32(x, y);
+                return _mm512_min_epu32(c, _mm512_sub_epi32(c, p));
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i sub(__m512i x, __m512i y, __m512i p){
+                __m512i d = _mm512_sub_epi32(x, y);
+                return _mm512_min_epu32(d, _mm512_add_epi32(d, p));
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX512 static __m512i mul_root(__m512i x, __m512i w, __m512i p, __m512i inv){
+                __m512i e = _mm512_mul_epu32(x, w), o = _mm512_mul_epu32(_mm512_srli_epi64(x, 32), _mm512_srli_epi64(w, 32));
+                e = _mm512_add_epi64(e, _mm512_mul_epu32(_mm512_mul_epu32(e, inv), p));
+                o = _mm512_add_epi64(o, _mm512_mul_epu32(_mm512_mul_epu32(o, inv), p));
+                __m512i r = _mm512_mask_blend_epi32(static_cast<__mmask16>(0xaaaa), _mm512_srli_epi64(e, 32), o);
+                return _mm512_min_epu32(r, _mm512_sub_epi32(r, p));
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX512 static void forward_stage(value_type *a, std::size_t n, std::size_t m, const value_type *w){
+                std::size_t h = m / 2;
+                if(h < width){
+                    ntt_avx2<Prime>::forward_stage(a, n, m, w);
+                    return;
+                }
+                const __m512i p = _mm512_set1_epi32(static_cast<int>(Prime::mod)), inv = _mm512_set1_epi32(static_cast<int>(Prime::modmul::inv));
+                for(std::size_t i = 0; i < n; i += m){
+                    value_type *s = a + i, *t = s + h;
+                    for(std::size_t j = 0; j < h; j += width){
+                        __m512i u = load(s + j), v = load(t + j);
+                        store(s + j, add(u, v, p));
+                        store(t + j, mul_root(sub(u, v, p), load(w + j), p, inv));
+                    }
+                }
+            }
+
+            CPP_MULTI_PRECISION_TARGET_AVX512 static void inverse_stage(value_type *a, std::size_t n, std::size_t m, const value_type *w){
+                std::size_t h = m / 2;
+                if(h < width){
+                    ntt_avx2<Prime>::inverse_stage(a, n, m, w);
+                    return;
+                }
+                const __m512i p = _mm512_set1_epi32(static_cast<int>(Prime::mod)), inv = _mm512_set1_epi32(static_cast<int>(Prime::modmul::inv));
+                for(std::size_t i = 0; i < n; i += m){
+                    value_type *s = a + i, *t = s + h;
+                    for(std::size_t j = 0; j < h; j += width){
+                        __m512i u = load(s + j), v = mul_root(load(t + j), load(w + j), p, inv);
+                        store(s + j, add(u, v, p));
+                        store(t + j, sub(u, v, p));
+                    }
+                }
+            }
+        };
+
+        template<class Prime>
+        struct ntt_dispatch<Prime, true>{
+            template<class Table>
+            static void bind(Table &t){
+                const cpu_features &f = cpu_features::get();
+                if(f.avx512f){
+                    t.forward_stage = &ntt_avx512<Prime>::forward_stage;
+                    t.inverse_stage = &ntt_avx512<Prime>::inverse_stage;
+                }else if(f.avx2){
+                    t.forward_stage = &ntt_avx2<Prime>::forward_stage;
+                    t.inverse_stage = &ntt_avx2<Prime>::inverse_stage;
+                }
+            }
+        };
+#endif
+    }
+}
+
+#endif
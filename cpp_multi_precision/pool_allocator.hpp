@@ -0,0 +1,279 @@
+#ifndef HPP_CPP_MULTI_PRECISION_POOL_ALLOCATOR
+#define HPP_CPP_MULTI_PRECISION_POOL_ALLOCATOR
+
+#include <cstddef>
+#include <new>
+#include <limits>
+#include <atomic>
+
+namespace cpp_multi_precision{
+    struct pool_statistics{
+        std::size_t allocations, deallocations;
+        std::size_t pool_hits, arena_hits;
+        std::size_t system_allocations, system_deallocations;
+        std::size_t bytes_in_use, peak_bytes_in_use;
+        std::size_t foreign_deallocations;
+    };
+
+    class pool_arena;
+
+    namespace aux{
+        class limb_pool{
+        public:
+            static const std::size_t min_class_log2 = 6, class_count = 15;
+            static const std::size_t max_cached_blocks = 64;
+            static const std::size_t header_size = 32;
+            static const std::size_t arena_chunk_size = 1 << 16;
+
+            struct header{
+                std::size_t capacity;
+                pool_arena *arena;
+                std::size_t owner;
+            };
+
+            struct state_type{
+                void *free_list[class_count];
+                std::size_t free_count[class_count];
+                pool_arena *arena;
+                pool_statistics statistics;
+                std::size_t id;
+                bool registered, dead;
+            };
+
+            static state_type &state(){
+                static thread_local state_type s;
+                return s;
+            }
+
+            static std::size_t size_class(std::size_t bytes, std::size_t &capacity){
+                std::size_t c = 0;
+                capacity = static_cast<std::size_t>(1) << min_class_log2;
+                for(; c < class_count && capacity < bytes; ++c, capacity <<= 1);
+                if(c == class_count){ capacity = (bytes + header_size - 1) / header_size * header_size; }
+                return c;
+            }
+
+            static void *allocate(std::size_t bytes);
+            static void deallocate(void *p);
+
+            static void trim(){
+                state_type &s = state();
+                for(std::size_t c = 0; c < class_count; ++c){
+                    while(s.free_list[c]){
+                        void *next = *static_cast<void**>(s.free_list[c]);
+                        ::operator delete(static_cast<char*>(s.free_list[c]) - header_size);
+                        ++s.statistics.system_deallocations;
+                        s.free_list[c] = next;
+                    }
+                    s.free_count[c] = 0;
+                }
+            }
+
+        private:
+            struct guard{
+                ~guard(){
+                    trim();
+                    state().dead = true;
+                }
+            };
+
+            static void register_thread(){
+                static thread_local guard g;
+                static_cast<void>(g);
+                state().registered = true;
+            }
+
+            static std::size_t thread_id(state_type &s){
+                static std::atomic<std::size_t> counter(0);
+                if(s.id == 0){ s.id = ++counter; }
+                return s.id;
+            }
+
+            static void *enter(state_type &s, header *h, std::size_t capacity, pool_arena *arena){
+                h->capacity = capacity, h->arena = arena, h->owner = thread_id(s);
+                s.statistics.bytes_in_use += capacity;
+                if(s.statistics.bytes_in_use > s.statistics.peak_bytes_in_use){ s.statistics.peak_bytes_in_use = s.statistics.bytes_in_use; }
+                return reinterpret_cast<char*>(h) + header_size;
+            }
+        };
+    }
+
+    class pool_arena{
+    public:
+        pool_arena() : chunk(0), current(0), last(0), reserved_(0), previous(aux::limb_pool::state().arena){
+            for(std::size_t c = 0; c < aux::limb_pool::class_count; ++c){ free_list[c] = 0; }
+            aux::limb_pool::state().arena = this;
+        }
+
+        ~pool_arena(){
+            aux::limb_pool::state().arena = previous;
+            while(chunk){
+                char *next = *reinterpret_cast<char**>(chunk);
+                ::operator delete(chunk);
+                ++aux::limb_pool::state().statistics.system_deallocations;
+                chunk = next;
+            }
+        }
+
+        std::size_t reserved() const{
+            return reserved_;
+        }
+
+    private:
+        friend class aux::limb_pool;
+
+        pool_arena(const pool_arena&);
+        pool_arena &operator =(const pool_arena&);
+
+        aux::limb_pool::header *allocate(std::size_t block_size, std::size_t c){
+            if(c < aux::limb_pool::class_count && free_list[c]){
+                void *p = free_list[c];
+                free_list[c] = *static_cast<void**>(p);
+                return reinterpret_cast<aux::limb_pool::header*>(static_cast<char*>(p) - aux::limb_pool::header_size);
+            }
+            if(static_cast<std::size_t>(last - current) < block_size){
+                std::size_t n = aux::limb_pool::header_size + (block_size > aux::limb_pool::arena_chunk_size ? block_size : aux::limb_pool::arena_chunk_size);
+                char *p = static_cast<char*>(::operator new(n));
+                ++aux::limb_pool::state().statistics.system_allocations;
+                *reinterpret_cast<char**>(p) = chunk;
+                chunk = p, current = p + aux::limb_pool::header_size, last = p + n;
+                reserved_ += n;
+            }
+            aux::limb_pool::header *h = reinterpret_cast<aux::limb_pool::header*>(current);
+            current += block_size;
+            return h;
+        }
+
+        void deallocate(void *p, std::size_t c){
+            if(c >= aux::limb_pool::class_count){ return; }
+            *static_cast<void**>(p) = free_list[c];
+            free_list[c] = p;
+        }
+
+        char *chunk, *current, *last;
+        std::size_t reserved_;
+        void *free_list[aux::limb_pool::class_count];
+        pool_arena *previous;
+    };
+
+    namespace aux{
+        inline void *limb_pool::allocate(std::size_t bytes){
+            state_type &s = state();
+            std::size_t capacity, c = size_class(bytes, capacity);
+            ++s.statistics.allocations;
+            if(s.arena){
+                ++s.statistics.arena_hits;
+                return enter(s, s.arena->allocate(capacity + header_size, c), capacity, s.arena);
+            }
+            if(c < class_count && s.free_list[c]){
+                void *p = s.free_list[c];
+                s.free_list[c] = *static_cast<void**>(p);
+                --s.free_count[c];
+                ++s.statistics.pool_hits;
+                return enter(s, reinterpret_cast<header*>(static_cast<char*>(p) - header_size), capacity, 0);
+            }
+            if(!s.registered && !s.dead){ register_thread(); }
+            ++s.statistics.system_allocations;
+            return enter(s, static_cast<header*>(::operator new(capacity + header_size)), capacity, 0);
+        }
+
+        inline void limb_pool::deallocate(void *p){
+            if(!p){ return; }
+            state_type &s = state();
+            header *h = reinterpret_cast<header*>(static_cast<char*>(p) - header_size);
+            std::size_t capacity, c = size_class(h->capacity, capacity);
+            ++s.statistics.deallocations;
+            if(h->owner != s.id){
+                ++s.statistics.foreign_deallocations;
+                if(h->arena){ return; }
+                ++s.statistics.system_deallocations;
+                ::operator delete(h);
+                return;
+            }
+            s.statistics.bytes_in_use -= h->capacity;
+            if(h->arena){
+                h->arena->deallocate(p, c);
+                return;
+            }
+            if(c < class_count && !s.dead && s.free_count[c] < max_cached_blocks){
+                *static_cast<void**>(p) = s.free_list[c];
+                s.free_list[c] = p;
+                ++s.free_count[c];
+                return;
+            }
+            ++s.statistics.system_deallocations;
+            ::operator delete(h);
+        }
+    }
+
+    template<class T>
+    class pool_allocator{
+    public:
+        typedef T value_type;
+        typedef T *pointer;
+        typedef const T *const_pointer;
+        typedef T &reference;
+        typedef const T &const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        template<class U>
+        struct rebind{ typedef pool_allocator<U> other; };
+
+        pool_allocator(){}
+        pool_allocator(const pool_allocator&){}
+        template<class U>
+        pool_allocator(const pool_allocator<U>&){}
+
+        pointer address(reference x) const{ return &x; }
+        const_pointer address(const_reference x) const{ return &x; }
+
+        pointer allocate(size_type n, const void* = 0){
+            if(n > max_size()){ throw std::bad_alloc(); }
+            return static_cast<pointer>(aux::limb_pool::allocate(n * sizeof(T)));
+        }
+
+        void deallocate(pointer p, size_type){
+            aux::limb_pool::deallocate(p);
+        }
+
+        size_type max_size() const{
+            return ((std::numeric_limits<size_type>::max)() - aux::limb_pool::arena_chunk_size) / sizeof(T);
+        }
+
+        void construct(pointer p, const T &value){
+            ::new(static_cast<void*>(p)) T(value);
+        }
+
+        void destroy(pointer p){
+            p->~T();
+        }
+
+        static const pool_statistics &statistics(){
+            return aux::limb_pool::state().statistics;
+        }
+
+        static void reset_statistics(){
+            pool_statistics &s(aux::limb_pool::state().statistics);
+            std::size_t in_use = s.bytes_in_use;
+            s = pool_statistics();
+            s.bytes_in_use = s.peak_bytes_in_use = in_use;
+        }
+
+        static void trim(){
+            aux::limb_pool::trim();
+        }
+    };
+
+    template<class T, class U>
+    bool operator ==(const pool_allocator<T>&, const pool_allocator<U>&){
+        return true;
+    }
+
+    template<class T, class U>
+    bool operator !=(const pool_allocator<T>&, const pool_allocator<U>&){
+        return false;
+    }
+}
+
+#endif
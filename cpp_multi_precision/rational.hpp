@@ -290,8 +290,8 @@ namespace cpp_multi_precision{
             if(numerator == 0){ denominator = 1; return; }
             integer_type gcd;
             integer_type::gcd(gcd, numerator, denominator);
-            numerator = numerator / gcd;
-            denominator = denominator / gcd;
+            integer_type::divexact(numerator, numerator, gcd);
+            integer_type::divexact(denominator, denominator, gcd);
         }
 
         template<class Str, class Char, class IntegerToString>
@@ -648,13 +648,14 @@ namespace cpp_multi_precision{
             result = x;
             coefficient_type c = x.cont();
             if(c == 1){ return result; }
+            bool exact = result.container.size() > 1;
             for(
                 typename container_type::iterator iter = result.container.begin(), end = result.container.end();
                 iter != end;
                 ++iter
             ){
                 coefficient_type &coe(iter->second);
-                coe /= c;
+                if(exact){ aux::divexact_dispatch(coe, coe, c); }else{ coe /= c; }
                 if(coe == 0){ iter = result.container.erase(iter); }
             }
             return result;
@@ -1294,7 +1295,6 @@ namespace cpp_multi_precision{
         ){
             result.container.clear();
             order_type temp_order;
-            coefficient_type temp_coefficient;
             for(typename container_type::const_iterator lhs_iter = lhs_first, lhs_end = lhs_last; lhs_iter != lhs_end; ++lhs_iter){
                 const order_type &lhs_order(lhs_iter->first);
                 const coefficient_type &lhs_coe(lhs_iter->second);
@@ -1303,8 +1303,7 @@ namespace cpp_multi_precision{
                     const coefficient_type &rhs_coe(rhs_iter->second);
                     temp_order = rhs_order;
                     temp_order += lhs_order;
-                    temp_coefficient = lhs_coe * rhs_coe;
-                    result.addition_order_coe(temp_order, temp_coefficient);
+                    result.addmul_order_coe(temp_order, lhs_coe, rhs_coe);
                 }
             }
         }
@@ -1973,6 +1972,17 @@ namespace cpp_multi_precision{
             }
         }
 
+        void addmul_order_coe(const order_type &order, const coefficient_type &lhs, const coefficient_type &rhs){
+            typename container_type::iterator iter = container.find(order);
+            if(iter == container.end()){
+                container.add(typename container_type::ref_value_type(order, lhs * rhs));
+            }else{
+                coefficient_type &lhs_coe(iter->second);
+                aux::addmul_dispatch(lhs_coe, lhs, rhs);
+                if(lhs_coe == 0){ container.erase(iter); }
+            }
+        }
+
         void subtraction_order_coe(const order_type &order, const coefficient_type &coe){
             typename container_type::iterator iter = container.find(order);
             if(iter == container.end()){
@@ -5,6 +5,8 @@
 #include <iterator>
 #include <type_traits>
 #include <cassert>
+#include <algorithm>
+#include <memory>
 
 namespace cpp_multi_precision{
     template<std::size_t ArraySize>
@@ -310,6 +312,270 @@ namespace cpp_multi_precision{
             std::size_t pos;
             aligned_storage element_array[array_size];
         };
+
+        template<class Element, class Allocator = std::allocator<Element>>
+        class small_vector{
+            static_assert(std::is_trivial<Element>::value, "cpp_multi_precision::storaged_container::small_vector - 'Element is trivial'");
+
+        public:
+            typedef typename Allocator::reference reference;
+            typedef typename Allocator::const_reference const_reference;
+            typedef Element *iterator;
+            typedef const Element *const_iterator;
+            typedef std::size_t size_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef Element value_type;
+            typedef Allocator allocator_type;
+            typedef typename Allocator::pointer pointer;
+            typedef typename Allocator::const_pointer const_pointer;
+            typedef std::reverse_iterator<iterator> reverse_iterator;
+            typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+            small_vector() : ptr(element_array), pos(0), cap(array_size){}
+
+            small_vector(const small_vector &other) : ptr(element_array), pos(0), cap(array_size){
+                assign(other.begin(), other.end());
+            }
+
+            small_vector(small_vector &&other) : ptr(element_array), pos(0), cap(array_size){
+                steal(other);
+            }
+
+            small_vector(size_type n, const Element &element = Element()) : ptr(element_array), pos(0), cap(array_size){
+                assign(n, element);
+            }
+
+            template<class Iter>
+            small_vector(const Iter &first, const Iter &last) : ptr(element_array), pos(0), cap(array_size){
+                assign(first, last);
+            }
+
+            ~small_vector(){
+                release();
+            }
+
+            small_vector &operator =(const small_vector &other){
+                if(this != &other){ assign(other.begin(), other.end()); }
+                return *this;
+            }
+
+            small_vector &operator =(small_vector &&other){
+                if(this != &other){
+                    release();
+                    ptr = element_array, pos = 0, cap = array_size;
+                    steal(other);
+                }
+                return *this;
+            }
+
+            iterator begin(){ return ptr; }
+            const_iterator begin() const{ return ptr; }
+            iterator end(){ return ptr + pos; }
+            const_iterator end() const{ return ptr + pos; }
+            reverse_iterator rbegin(){ return reverse_iterator(end()); }
+            const_reverse_iterator rbegin() const{ return const_reverse_iterator(end()); }
+            reverse_iterator rend(){ return reverse_iterator(begin()); }
+            const_reverse_iterator rend() const{ return const_reverse_iterator(begin()); }
+
+            size_type size() const{
+                return pos;
+            }
+
+            size_type max_size() const{
+                return Allocator().max_size();
+            }
+
+            size_type capacity() const{
+                return cap;
+            }
+
+            bool empty() const{
+                return pos == 0;
+            }
+
+            bool is_inline() const{
+                return ptr == element_array;
+            }
+
+            void reserve(size_type n){
+                if(n > cap){ reallocate(n); }
+            }
+
+            reference operator [](size_type n){
+                return ptr[n];
+            }
+
+            const_reference operator [](size_type n) const{
+                return ptr[n];
+            }
+
+            reference at(size_type n){
+                assert(n < pos);
+                return ptr[n];
+            }
+
+            const_reference at(size_type n) const{
+                assert(n < pos);
+                return ptr[n];
+            }
+
+            reference front(){
+                assert(pos > 0);
+                return ptr[0];
+            }
+
+            const_reference front() const{
+                assert(pos > 0);
+                return ptr[0];
+            }
+
+            reference back(){
+                assert(pos > 0);
+                return ptr[pos - 1];
+            }
+
+            const_reference back() const{
+                assert(pos > 0);
+                return ptr[pos - 1];
+            }
+
+            template<class Iter>
+            void assign(Iter first, Iter last){
+                size_type n = std::distance(first, last);
+                pos = 0;
+                reserve(n);
+                for(size_type i = 0; i < n; ++i, ++first){
+                    ptr[i] = *first;
+                }
+                pos = n;
+            }
+
+            void assign(size_type n, const Element &element){
+                pos = 0;
+                reserve(n);
+                std::fill(ptr, ptr + n, element);
+                pos = n;
+            }
+
+            void push_back(const_reference element){
+                if(pos == cap){
+                    value_type v = element;
+                    grow(pos + 1);
+                    ptr[pos++] = v;
+                }else{
+                    ptr[pos++] = element;
+                }
+            }
+
+            void pop_back(){
+                assert(pos > 0);
+                --pos;
+            }
+
+            iterator insert(const_iterator iter, const_reference value){
+                value_type v = value;
+                size_type i = iter - ptr;
+                open(i, 1);
+                ptr[i] = v;
+                return ptr + i;
+            }
+
+            void insert(const_iterator iter, size_type num, const_reference value){
+                value_type v = value;
+                size_type i = iter - ptr;
+                open(i, num);
+                std::fill(ptr + i, ptr + (i + num), v);
+            }
+
+            template<class Iter>
+            void insert(const_iterator iter, const Iter &first, const Iter &last){
+                size_type i = iter - ptr, num = std::distance(first, last);
+                small_vector temp(first, last);
+                open(i, num);
+                std::copy(temp.begin(), temp.end(), ptr + i);
+            }
+
+            iterator erase(const_iterator position){
+                return erase(position, position + 1);
+            }
+
+            iterator erase(const_iterator first, const_iterator last){
+                size_type i = first - ptr, num = last - first;
+                std::copy(ptr + (i + num), ptr + pos, ptr + i);
+                pos -= num;
+                return ptr + i;
+            }
+
+            void resize(size_type n){
+                resize(n, value_type());
+            }
+
+            void resize(size_type n, const Element &element){
+                if(n > pos){
+                    value_type v = element;
+                    reserve(n);
+                    std::fill(ptr + pos, ptr + n, v);
+                }
+                pos = n;
+            }
+
+            void swap(small_vector &other){
+                small_vector temp(std::move(other));
+                other = std::move(*this);
+                *this = std::move(temp);
+            }
+
+            void clear(){
+                pos = 0;
+            }
+
+            bool operator ==(const small_vector &other) const{
+                return pos == other.pos && std::equal(begin(), end(), other.begin());
+            }
+
+            bool operator !=(const small_vector &other) const{
+                return !(*this == other);
+            }
+
+        private:
+            void steal(small_vector &other){
+                if(other.is_inline()){
+                    std::copy(other.begin(), other.end(), ptr);
+                    pos = other.pos;
+                }else{
+                    ptr = other.ptr, pos = other.pos, cap = other.cap;
+                    other.ptr = other.element_array;
+                    other.cap = array_size;
+                }
+                other.pos = 0;
+            }
+
+            void release(){
+                if(!is_inline()){ Allocator().deallocate(ptr, cap); }
+            }
+
+            void reallocate(size_type n){
+                Allocator alloc;
+                value_type *p = alloc.allocate(n);
+                std::copy(ptr, ptr + pos, p);
+                release();
+                ptr = p, cap = n;
+            }
+
+            void grow(size_type n){
+                reallocate((std::max)(n, cap * 2));
+            }
+
+            void open(size_type i, size_type num){
+                if(pos + num > cap){ grow(pos + num); }
+                std::copy_backward(ptr + i, ptr + pos, ptr + (pos + num));
+                pos += num;
+            }
+
+            value_type *ptr;
+            size_type pos, cap;
+            value_type element_array[array_size];
+        };
     };
 }
 
@@ -2,6 +2,7 @@
 #define HPP_CPP_MULTI_PRECISION_UNSIGNED_INTEGER
 
 #include "ns_aux.hpp"
+#include "limb_kernel.hpp"
 
 namespace cpp_multi_precision{
     template<class RadixType, std::size_t RadixLog2, class Radix2Type, class URadix2Type, class Container, class Allocator = std::allocator<int>>
@@ -13,23 +14,23 @@ namespace cpp_multi_precision{
         typedef Radix2Type radix2_type;
         typedef URadix2Type unsigned_radix2_type;
         typedef typename aux::rebind_container<Container>::template rebind<radix_type, typename Allocator::template rebind<radix_type>::other>::other container_type;
-
-        unsigned_integer() : normalize_container(&unsigned_integer::normalize_container_impl){ assign(0); }
-        unsigned_integer(unsigned_radix2_type value) : normalize_container(&unsigned_integer::normalize_container_impl){ assign(value); }
-        unsigned_integer(const unsigned_integer &other) : normalize_container(other.normalize_container), container(other.container){}
-        unsigned_integer(unsigned_integer &&other) : normalize_container(other.normalize_container), container(other.container){}
-        unsigned_integer(const container_type &other_container) : normalize_container(&unsigned_integer::normalize_container_impl), container(other_container){}
+        typedef std::vector<radix_type, typename Allocator::template rebind<radix_type>::other> scratch_type;
+        typedef aux::limb_kernel<radix_type, unsigned_radix2_type, radix_log2> kernel_type;
+
+        unsigned_integer(){ assign(0); }
+        unsigned_integer(unsigned_radix2_type value){ assign(value); }
+        unsigned_integer(const unsigned_integer &other) : container(other.container){}
+        unsigned_integer(unsigned_integer &&other) CPP_MULTI_PRECISION_NOEXCEPT : container(std::move(other.container)){}
+        unsigned_integer(const container_type &other_container) : container(other_container){}
         template<class Iterator>
-        unsigned_integer(const Iterator &first, const Iterator &last) : normalize_container(&unsigned_integer::normalize_container_impl){ assign(first, last); }
-
-        virtual ~unsigned_integer(){}
+        unsigned_integer(const Iterator &first, const Iterator &last){ assign(first, last); }
 
         void assign(const unsigned_integer &other){
             container.assign(other.container.begin(), other.container.end());
         }
 
-        void assign(unsigned_integer &&other){
-            container = other.container;
+        void assign(unsigned_integer &&other) CPP_MULTI_PRECISION_NOEXCEPT{
+            container.swap(other.container);
         }
 
         void assign(unsigned_radix2_type v){
@@ -55,7 +56,7 @@ namespace cpp_multi_precision{
             }else{
                 container.assign(first, last);
             }
-            (this->*normalize_container)();
+            normalize_container_impl();
         }
 
         void read(const char *str){
@@ -87,12 +88,17 @@ namespace cpp_multi_precision{
             return *this;
         }
 
-        unsigned_integer &operator =(unsigned_integer &&rhs){
-            container = std::move(rhs.container);
+        unsigned_integer &operator =(unsigned_integer &&rhs) CPP_MULTI_PRECISION_NOEXCEPT{
+            container.swap(rhs.container);
             return *this;
         }
 
         unsigned_integer &operator +=(const unsigned_integer &rhs){
+            unsigned_radix2_type x, y;
+            if(small_value(x) && rhs.small_value(y) && x + y >= x){
+                assign(x + y);
+                return *this;
+            }
             return add_range(rhs.container.begin(), rhs.container.end());
         }
 
@@ -103,6 +109,11 @@ namespace cpp_multi_precision{
         }
 
         unsigned_integer &operator -=(const unsigned_integer &rhs){
+            unsigned_radix2_type x, y;
+            if(small_value(x) && rhs.small_value(y) && x >= y){
+                assign(x - y);
+                return *this;
+            }
             return sub_range(rhs.container.begin(), rhs.container.end());
         }
 
@@ -114,7 +125,7 @@ namespace cpp_multi_precision{
 
         unsigned_integer operator *(const unsigned_integer &rhs) const{
             unsigned_integer r;
-            square_multi(r, *this, rhs);
+            limb_multi(r, *this, rhs);
             return std::move(r);
         }
 
@@ -262,7 +273,7 @@ namespace cpp_multi_precision{
 
         void rev(){
             std::reverse(container.begin(), container.end());
-            (this->*normalize_container)();
+            normalize_container_impl();
         }
 
         static unsigned_integer &ceil_pow2(unsigned_integer &result, const unsigned_integer &a){
@@ -311,7 +322,43 @@ namespace cpp_multi_precision{
 
         static unsigned_integer &pp(unsigned_integer &result, const unsigned_integer &x){
             unsigned_integer y(x.cont());
-            div(result, x, y);
+            divexact(result, x, y);
+            return result;
+        }
+
+        static unsigned_integer &divexact(unsigned_integer &result, const unsigned_integer &lhs, const unsigned_integer &rhs){
+            assert(rhs != 0);
+            if(lhs == 0){
+                result.assign(0);
+                return result;
+            }
+            std::size_t z = 0, s = 0;
+            while(z + 1 < rhs.container.size() && rhs.container[z] == 0){ ++z; }
+            while(s + 1 < radix_log2 && ((rhs.container[z] >> s) & 1) == 0){ ++s; }
+            std::size_t shift = z * radix_log2 + s;
+            unsigned_integer r(lhs), d;
+            if(shift > 0){
+                r >>= shift;
+                d = rhs;
+                d >>= shift;
+            }
+            const container_type &dc(shift > 0 ? d.container : rhs.container);
+            std::size_t rn = r.container.size(), dn = dc.size();
+            if(dn == 1){
+                kernel_type::divexact_1(&r.container[0], &r.container[0], rn, dc[0]);
+                r.normalize_container_impl();
+                result = std::move(r);
+                return result;
+            }
+            std::size_t qn = rn - dn + 1;
+            if((std::min)(qn, dn) >= threshold_divexact){
+                return div(result, lhs, rhs);
+            }
+            unsigned_integer q;
+            q.container.resize(qn);
+            kernel_type::bdiv_q_basecase(&q.container[0], &r.container[0], qn, &dc[0], dn);
+            q.normalize_container_impl();
+            result = std::move(q);
             return result;
         }
 
@@ -323,25 +370,103 @@ namespace cpp_multi_precision{
             }
         }
 
+        static unsigned_integer &square(unsigned_integer &result, const unsigned_integer &x){
+            std::size_t n = x.container.size();
+            if(n >= threshold_ntt_square && ntt_multi_enable(n, n)){
+                ntt_square(result, x.container.begin(), x.container.end(), n);
+            }else{
+                result.container.resize(n * 2);
+                scratch_type scratch(kar_scratch_size(n, threshold_kar_square) + 1);
+                kar_square_raw(&result.container[0], &x.container[0], n, &scratch[0]);
+                result.normalize_container_impl();
+            }
+            return result;
+        }
+
         static unsigned_integer &pow(unsigned_integer &result, const unsigned_integer &x, const unsigned_integer &y){
-            return pow_impl<unsigned_integer>(result, x, y, square_multi);
+            return pow_impl<false>(
+                result, x, y,
+                limb_multi,
+                square
+            );
         }
 
         static unsigned_integer &sqrt(unsigned_integer &result, const unsigned_integer &a){
-            if(a == 1){
-                result = 1;
+            unsigned_integer rem;
+            return sqrtrem(result, rem, a);
+        }
+
+        static unsigned_integer &sqrtrem(unsigned_integer &result, unsigned_integer &rem, const unsigned_integer &a){
+            if(a == 0){
+                result = 0, rem = 0;
                 return result;
             }
-            result = a >> 1;
-            unsigned_integer prev_x = result;
-            do{
-                prev_x = result;
-                result = (result + a / result) >> 1;
-                if(result * result <= a){ break; }
-            }while(prev_x != result);
+            std::size_t m = (a.container.size() + 1) / 2, t = (m * 2 * radix_log2 - a.bit_num() - 1) / 2;
+            unsigned_integer x = a << (t * 2);
+            sqrtrem_rec(result, rem, x);
+            if(t > 0){
+                unsigned_integer u(result), w;
+                radix_type s0 = result.container[0] & ((static_cast<radix_type>(1) << t) - 1);
+                result >>= t;
+                u += result << t;
+                rem += multi(w, u, s0);
+                rem >>= t * 2;
+            }
+            return result;
+        }
+
+        static bool is_perfect_square(const unsigned_integer &a){
+            static const unsigned long long sq256[] = { 0x0202021202030213ull, 0x0202021202020213ull, 0x0202021202030212ull, 0x0202021202020212ull };
+            static const unsigned long long sq63[] = { 0x0402483012450293ull };
+            static const unsigned long long sq65[] = { 0x218a019866014613ull, 0x0000000000000001ull };
+            static const unsigned long long sq11[] = { 0x000000000000023bull };
+            if(!is_square_residue(sq256, a.container[0] & 0xff)){ return false; }
+            unsigned_radix2_type r = mod_radix(a, 63 * 65 * 11);
+            if(!is_square_residue(sq63, r % 63) || !is_square_residue(sq65, r % 65) || !is_square_residue(sq11, r % 11)){ return false; }
+            unsigned_integer s, rem;
+            sqrtrem(s, rem, a);
+            return rem == 0;
+        }
+
+        bool is_perfect_square() const{
+            return is_perfect_square(*this);
+        }
+
+        static unsigned_integer &rootrem(unsigned_integer &result, unsigned_integer &rem, const unsigned_integer &a, std::size_t k){
+            if(k == 2){ return sqrtrem(result, rem, a); }
+            if(k == 1 || a <= 1){
+                result = a, rem = 0;
+                return result;
+            }
+            if(k > a.bit_num()){
+                result = 1, rem = a - 1;
+                return result;
+            }
+            unsigned_integer pk;
+            root_rec(result, pk, a, k);
+            rem = a - pk;
             return result;
         }
 
+        static unsigned_integer &root(unsigned_integer &result, const unsigned_integer &a, std::size_t k){
+            unsigned_integer rem;
+            return rootrem(result, rem, a, k);
+        }
+
+        unsigned_integer root(std::size_t k) const{
+            unsigned_integer r;
+            root(r, *this, k);
+            return std::move(r);
+        }
+
+        static bool is_perfect_power(const unsigned_integer &a){
+            return is_perfect_power_impl(a, false);
+        }
+
+        bool is_perfect_power() const{
+            return is_perfect_power(*this);
+        }
+
         radix_type n_bit(std::size_t n) const{
             return (container[n / radix_log2] >> (n % radix_log2)) & 1;
         }
@@ -361,6 +486,179 @@ namespace cpp_multi_precision{
             return a < b ? a : b;
         }
 
+        class reciprocal{
+        public:
+            reciprocal(const unsigned_integer &d) : shift(0){
+                if(d == 0){ throw std::domain_error("cpp_multi_precision::unsigned_integer::reciprocal - division by zero"); }
+                for(radix_type leftmost = d.container.back(); (leftmost >> (radix_log2 - 1)) == 0; leftmost <<= 1){ ++shift; }
+                divisor = d << shift;
+                approx_reciprocal(inv, divisor);
+            }
+
+            unsigned_integer &div(unsigned_integer &result, unsigned_integer &rem, const unsigned_integer &a) const{
+                unsigned_integer u(a << shift);
+                if(u < divisor){
+                    rem.assign(a);
+                    result.assign(0);
+                    return result;
+                }
+                std::size_t n = divisor.container.size(), un = u.container.size(), k = (un + n - 1) / n;
+                result.container.assign(k * n, 0);
+                rem.assign(0);
+                unsigned_integer cur, q;
+                for(std::size_t i = k; i > 0; --i){
+                    std::size_t s = (i - 1) * n, e = (std::min)(i * n, un);
+                    cur.container.assign(u.container.begin() + s, u.container.begin() + e);
+                    if(rem != 0){
+                        cur.container.resize(n, 0);
+                        cur.container.insert(cur.container.end(), rem.container.begin(), rem.container.end());
+                    }
+                    cur.normalize_container_impl();
+                    step(q, rem, cur);
+                    std::copy(q.container.begin(), q.container.end(), result.container.begin() + s);
+                }
+                result.normalize_container_impl();
+                rem >>= shift;
+                return result;
+            }
+
+            unsigned_integer &mod(unsigned_integer &rem, const unsigned_integer &a) const{
+                unsigned_integer result;
+                div(result, rem, a);
+                return rem;
+            }
+
+            unsigned_integer divisor_value() const{
+                return divisor >> shift;
+            }
+
+        private:
+            void step(unsigned_integer &q, unsigned_integer &r, const unsigned_integer &cur) const{
+                std::size_t n = divisor.container.size();
+                q = high(high(cur, n - 1) * inv, n + 1);
+                r = cur - q * divisor;
+                while(r >= divisor){
+                    r -= divisor;
+                    q += 1;
+                }
+            }
+
+            static unsigned_integer high(const unsigned_integer &a, std::size_t n){
+                if(a.container.size() <= n){ return unsigned_integer(); }
+                return unsigned_integer(a.container.begin() + n, a.container.end());
+            }
+
+            static unsigned_integer radix_power(std::size_t n){
+                unsigned_integer r;
+                r.container.assign(n + 1, 0);
+                r.container.back() = 1;
+                return std::move(r);
+            }
+
+            static void approx_reciprocal(unsigned_integer &x, const unsigned_integer &a){
+                std::size_t n = a.container.size();
+                if(n < threshold_bz_div){
+                    unsigned_integer rem;
+                    div_impl(x, rem, radix_power(n * 2) - 1, a);
+                    return;
+                }
+                std::size_t l = (n - 1) / 2, h = n - l;
+                unsigned_integer xh, t;
+                approx_reciprocal(xh, high(a, l));
+                t = a * xh;
+                unsigned_integer p(radix_power(n + h));
+                while(t >= p){
+                    xh -= 1;
+                    t -= a;
+                }
+                t = p - t;
+                x = xh;
+                x.radix_shift(l);
+                x += high(high(t, l) * xh, h * 2 - l);
+            }
+
+            std::size_t shift;
+            unsigned_integer divisor, inv;
+        };
+
+        class montgomery{
+        public:
+            montgomery(const unsigned_integer &m) : modulus(m){
+                assert((m.container[0] & 1) != 0);
+                inv = static_cast<radix_type>(0) - kernel_type::binvert(m.container[0]);
+                std::size_t n = m.container.size();
+                r2.container.assign(n * 2 + 1, 0);
+                r2.container.back() = 1;
+                r2 %= m;
+            }
+
+            unsigned_integer &to_montgomery(unsigned_integer &result, const unsigned_integer &a) const{
+                unsigned_integer t;
+                if(a < modulus){
+                    limb_multi(t, a, r2);
+                }else{
+                    limb_multi(t, a % modulus, r2);
+                }
+                redc(result, t);
+                return result;
+            }
+
+            unsigned_integer &from_montgomery(unsigned_integer &result, const unsigned_integer &a) const{
+                unsigned_integer t(a);
+                redc(result, t);
+                return result;
+            }
+
+            unsigned_integer &multi(unsigned_integer &result, const unsigned_integer &lhs, const unsigned_integer &rhs) const{
+                unsigned_integer t;
+                limb_multi(t, lhs, rhs);
+                redc(result, t);
+                return result;
+            }
+
+            unsigned_integer &square(unsigned_integer &result, const unsigned_integer &a) const{
+                unsigned_integer t;
+                unsigned_integer::square(t, a);
+                redc(result, t);
+                return result;
+            }
+
+            unsigned_integer &pow(unsigned_integer &result, const unsigned_integer &x, const unsigned_integer &y) const{
+                if(y == 0){
+                    result = unsigned_integer(1) % modulus;
+                    return result;
+                }
+                unsigned_integer xm, rm;
+                to_montgomery(xm, x);
+                pow_impl<false>(
+                    rm, xm, y,
+                    [this](unsigned_integer &r, const unsigned_integer &a, const unsigned_integer &b) -> unsigned_integer&{ return multi(r, a, b); },
+                    [this](unsigned_integer &r, const unsigned_integer &a) -> unsigned_integer&{ return square(r, a); }
+                );
+                return from_montgomery(result, rm);
+            }
+
+        private:
+            void redc(unsigned_integer &result, unsigned_integer &t) const{
+                std::size_t n = modulus.container.size();
+                container_type &t_container(t.container);
+                t_container.resize(n * 2 + 1, 0);
+                radix_type *tp = &t_container[0];
+                const radix_type *mp = &modulus.container[0];
+                for(std::size_t i = 0; i < n; ++i){
+                    radix_type u = static_cast<radix_type>(static_cast<unsigned_radix2_type>(tp[i]) * inv);
+                    radix_type c = kernel_type::addmul_1(tp + i, mp, n, u);
+                    kernel_type::incr(tp + (i + n), n + 1 - i, c);
+                }
+                result.container.assign(t_container.begin() + n, t_container.end());
+                result.normalize_container_impl();
+                if(result >= modulus){ result -= modulus; }
+            }
+
+            unsigned_integer modulus, r2;
+            radix_type inv;
+        };
+
     protected:
         const container_type &get_container() const{ return container; }
 
@@ -385,19 +683,22 @@ namespace cpp_multi_precision{
         }
 
         static unsigned_integer &multi(unsigned_integer &result, typename container_type::const_iterator lhs_it, const typename container_type::const_iterator &lhs_end, unsigned_radix2_type rhs){
-            result.assign(0);
-            std::size_t m = 0;
-            for(; lhs_it != lhs_end; ++lhs_it, ++m){
-                radix_type lhs = *lhs_it;
-                result.add_radix_n(static_cast<unsigned_radix2_type>(lhs) * rhs, m);
-            }
+            std::size_t n = std::distance(lhs_it, lhs_end);
+            radix_type lo = static_cast<radix_type>(rhs), hi = static_cast<radix_type>(rhs >> radix_log2);
+            container_type &r_container(result.container);
+            r_container.resize(n + 2);
+            const radix_type *a = &*lhs_it;
+            radix_type *r = &r_container[0];
+            r[n] = kernel_type::mul_1(r, a, n, lo);
+            r[n + 1] = hi != 0 ? kernel_type::addmul_1(r + 1, a, n, hi) : 0;
+            result.normalize_container_impl();
             return result;
         }
 
         static unsigned_integer &multi(unsigned_integer &result, radix_type x, radix_type y){
             result.assign(0);
             unsigned_radix2_type r = static_cast<unsigned_radix2_type>(x) * static_cast<unsigned_radix2_type>(y);
-            result.container.front() = static_cast<unsigned_radix2_type>(r % (static_cast<unsigned_radix2_type>(1) << radix_log2));
+            result.container.front() = static_cast<radix_type>(r);
             r >>= radix_log2;
             if(r > 0){ result.container.push_back(static_cast<radix_type>(r)); }    
             return result;
@@ -416,11 +717,14 @@ namespace cpp_multi_precision{
         ){
             container_type &r_container(result.container);
             if(!is_float){
-                r_container.resize(lhs_size + rhs_size - 1);
-                if(r_container.size() == 0){
+                if(lhs_size == 0 || rhs_size == 0){
                     result.assign(0);
                     return result;
                 }
+                r_container.resize(lhs_size + rhs_size);
+                kernel_type::mul_basecase(&r_container[0], &*lhs_begin, lhs_size, &*rhs_begin, rhs_size);
+                result.normalize_container_impl();
+                return result;
             }else{
                 r_container.resize(lhs_size + rhs_size - 3);
             }
@@ -436,74 +740,343 @@ namespace cpp_multi_precision{
             return result;
         }
 
-        static unsigned_integer &div(unsigned_integer &result, unsigned_integer &rem, const unsigned_integer &lhs, const unsigned_integer &rhs){
-            div_impl(result, rem, lhs, rhs);
-            return result;
+        static std::size_t kar_scratch_size(std::size_t n, std::size_t threshold){
+            std::size_t size = 0;
+            while(n >= threshold){
+                n = (n + 1) / 2;
+                size += 4 * n + 1;
+            }
+            return size;
+        }
+
+        static bool limb_abs_diff(radix_type *d, const radix_type *a, std::size_t an, const radix_type *b, std::size_t bn){
+            bool a_less = true;
+            for(std::size_t i = bn; i < an; ++i){
+                if(a[i] != 0){ a_less = false; break; }
+            }
+            if(a_less){ a_less = kernel_type::cmp(a, b, bn) < 0; }
+            if(a_less){
+                kernel_type::sub_n(d, b, a, bn);
+                std::fill(d + bn, d + an, static_cast<radix_type>(0));
+            }else{
+                radix_type c = kernel_type::sub_n(d, a, b, bn);
+                kernel_type::sub_1(d + bn, a + bn, an - bn, c);
+            }
+            return a_less;
+        }
+
+        static void kar_multi_raw(radix_type *r, const radix_type *x, std::size_t xn, const radix_type *y, std::size_t yn, radix_type *w){
+            if(xn < yn){
+                kar_multi_raw(r, y, yn, x, xn, w);
+                return;
+            }
+            if(yn < threshold_kar_multi){
+                kernel_type::mul_basecase(r, x, xn, y, yn);
+                return;
+            }
+            std::size_t h = (xn + 1) / 2;
+            if(yn <= h){
+                kar_multi_raw(r, x, yn, y, yn, w);
+                std::fill(r + yn * 2, r + (xn + yn), static_cast<radix_type>(0));
+                for(std::size_t i = yn; i < xn; i += yn){
+                    std::size_t m = (std::min)(yn, xn - i);
+                    kar_multi_raw(w, x + i, m, y, yn, w + yn * 2);
+                    kernel_type::add_n(r + i, r + i, w, m + yn);
+                }
+                return;
+            }
+            std::size_t xn1 = xn - h, yn1 = yn - h;
+            radix_type *t = w, *dx = w + h * 2, *dy = w + h * 3, *next = w + (h * 4 + 1);
+            bool neg = limb_abs_diff(dx, x, h, x + h, xn1) != limb_abs_diff(dy, y, h, y + h, yn1);
+            kar_multi_raw(t, dx, h, dy, h, next);
+            kar_multi_raw(r, x, h, y, h, next);
+            kar_multi_raw(r + h * 2, x + h, xn1, y + h, yn1, next);
+            kar_interpolate(r, xn + yn, h, t, neg, w + h * 2);
+        }
+
+        static void kar_square_raw(radix_type *r, const radix_type *x, std::size_t n, radix_type *w){
+            if(n < threshold_kar_square){
+                kernel_type::sqr_basecase(r, x, n);
+                return;
+            }
+            std::size_t h = (n + 1) / 2, n1 = n - h;
+            radix_type *t = w, *d = w + h * 2, *next = w + (h * 4 + 1);
+            limb_abs_diff(d, x, h, x + h, n1);
+            kar_square_raw(t, d, h, next);
+            kar_square_raw(r, x, h, next);
+            kar_square_raw(r + h * 2, x + h, n1, next);
+            kar_interpolate(r, n * 2, h, t, false, w + h * 2);
+        }
+
+        static void kar_interpolate(radix_type *r, std::size_t rn, std::size_t h, const radix_type *t, bool neg, radix_type *s){
+            {
+                std::size_t hn = rn - h * 2;
+                radix_type c = kernel_type::add_n(s, r, r + h * 2, hn);
+                s[h * 2] = kernel_type::add_1(s + hn, r + hn, h * 2 - hn, c);
+            }
+            if(neg){
+                radix_type c = kernel_type::add_n(s, s, t, h * 2);
+                s[h * 2] += c;
+            }else{
+                radix_type c = kernel_type::sub_n(s, s, t, h * 2);
+                s[h * 2] -= c;
+            }
+            {
+                std::size_t sn = (std::min)(h * 2 + 1, rn - h);
+                radix_type c = kernel_type::add_n(r + h, r + h, s, sn);
+                kernel_type::add_1(r + (h + sn), r + (h + sn), rn - h - sn, c);
+            }
         }
 
-        radix_type div_n_digit(const unsigned_integer &v){
-            std::size_t digit = v.container.size();
-            unsigned_radix2_type q = container[digit - 1];
-            if(container.size() > digit){
-                q += static_cast<unsigned_radix2_type>(container[digit]) << radix_log2;
+        static unsigned_integer &limb_multi(unsigned_integer &result, const unsigned_integer &lhs, const unsigned_integer &rhs){
+            std::size_t lhs_size = lhs.container.size(), rhs_size = rhs.container.size();
+            if(lhs_size == 1 && rhs_size == 1){
+                result.assign(static_cast<unsigned_radix2_type>(lhs.container[0]) * rhs.container[0]);
+                return result;
+            }
+            if((std::min)(lhs_size, rhs_size) >= threshold_ntt_multi && ntt_multi_enable(lhs_size, rhs_size)){
+                return ntt_multi(result, lhs.container.begin(), lhs.container.end(), rhs.container.begin(), rhs.container.end(), lhs_size, rhs_size);
             }
-            q /= v.container[digit - 1];
-            unsigned_integer qv;
-            multi(qv, v, q);
-            while(*this < qv){
-                --q;
-                *this += v;
+            result.container.resize(lhs_size + rhs_size);
+            scratch_type scratch(kar_scratch_size((std::max)(lhs_size, rhs_size), threshold_kar_multi) + 1);
+            kar_multi_raw(&result.container[0], &lhs.container[0], lhs_size, &rhs.container[0], rhs_size, &scratch[0]);
+            result.normalize_container_impl();
+            return result;
+        }
+
+        static bool ntt_multi_enable(std::size_t lhs_size, std::size_t rhs_size){
+            typedef aux::ntt_prime_set<radix_type, unsigned_radix2_type> prime_set;
+            return radix_log2 == sizeof(radix_type) * 8 && lhs_size + rhs_size - 1 <= (static_cast<std::size_t>(1) << prime_set::max_log2);
+        }
+
+        template<class Prime>
+        static void ntt_multi_prime(
+            scratch_type &r, scratch_type &w, std::size_t n,
+            typename container_type::const_iterator lhs_it, const typename container_type::const_iterator &lhs_end,
+            typename container_type::const_iterator rhs_it, const typename container_type::const_iterator &rhs_end,
+            bool is_square
+        ){
+            r.assign(n, 0);
+            for(std::size_t i = 0; lhs_it != lhs_end; ++lhs_it, ++i){ r[i] = *lhs_it % Prime::mod; }
+            Prime::transform(&r[0], n, w);
+            if(is_square){
+                for(std::size_t i = 0; i < n; ++i){ r[i] = Prime::mul(r[i], r[i]); }
+            }else{
+                scratch_type b(n, 0);
+                for(std::size_t i = 0; rhs_it != rhs_end; ++rhs_it, ++i){ b[i] = *rhs_it % Prime::mod; }
+                Prime::transform(&b[0], n, w);
+                for(std::size_t i = 0; i < n; ++i){ r[i] = Prime::mul(r[i], b[i]); }
             }
-            *this -= qv;
-            return static_cast<radix_type>(q);
+            Prime::inverse_transform(&r[0], n, w);
+        }
+
+        static unsigned_integer &ntt_multi(
+            unsigned_integer &result,
+            const typename container_type::const_iterator &lhs_begin, const typename container_type::const_iterator &lhs_end,
+            const typename container_type::const_iterator &rhs_begin, const typename container_type::const_iterator &rhs_end,
+            std::size_t lhs_size, std::size_t rhs_size
+        ){
+            return ntt_multi_impl(result, lhs_begin, lhs_end, rhs_begin, rhs_end, lhs_size, rhs_size, false);
         }
 
-        void div_copy_impl(const unsigned_integer &num, std::size_t s, std::size_t e){
-            container.clear();
-            while(s <= e){
-                if(s >= num.container.size()){ break; }
-                container.push_back(num.container[s++]);
+        static unsigned_integer &ntt_square(
+            unsigned_integer &result,
+            const typename container_type::const_iterator &begin, const typename container_type::const_iterator &end,
+            std::size_t size
+        ){
+            return ntt_multi_impl(result, begin, end, begin, end, size, size, true);
+        }
+
+        static unsigned_integer &ntt_multi_impl(
+            unsigned_integer &result,
+            const typename container_type::const_iterator &lhs_begin, const typename container_type::const_iterator &lhs_end,
+            const typename container_type::const_iterator &rhs_begin, const typename container_type::const_iterator &rhs_end,
+            std::size_t lhs_size, std::size_t rhs_size,
+            bool is_square
+        ){
+            typedef aux::ntt_prime_set<radix_type, unsigned_radix2_type> prime_set;
+            typedef typename prime_set::prime1_type prime1_type;
+            typedef typename prime_set::prime2_type prime2_type;
+            typedef typename prime_set::prime3_type prime3_type;
+            std::size_t m = lhs_size + rhs_size - 1, n = aux::ceil_pow2(m);
+            scratch_type r1, r2, r3, w;
+            ntt_multi_prime<prime1_type>(r1, w, n, lhs_begin, lhs_end, rhs_begin, rhs_end, is_square);
+            ntt_multi_prime<prime2_type>(r2, w, n, lhs_begin, lhs_end, rhs_begin, rhs_end, is_square);
+            ntt_multi_prime<prime3_type>(r3, w, n, lhs_begin, lhs_end, rhs_begin, rhs_end, is_square);
+            const radix_type p1 = prime1_type::mod, p2 = prime2_type::mod;
+            const radix_type inv_p1_p2 = prime2_type::inverse(p1 % prime2_type::mod);
+            const radix_type inv_p1_p3 = prime3_type::inverse(p1 % prime3_type::mod);
+            const radix_type inv_p2_p3 = prime3_type::inverse(p2 % prime3_type::mod);
+            const unsigned_radix2_type p1p2 = static_cast<unsigned_radix2_type>(p1) * p2;
+            const radix_type p1p2_lo = static_cast<radix_type>(p1p2), p1p2_hi = static_cast<radix_type>(p1p2 >> radix_log2);
+            container_type &r_container(result.container);
+            r_container.resize(m + 1);
+            radix_type c0 = 0, c1 = 0;
+            for(std::size_t i = 0; i < m; ++i){
+                radix_type t1 = r1[i];
+                radix_type t2 = prime2_type::mul(prime2_type::sub(r2[i], t1 % prime2_type::mod), inv_p1_p2);
+                radix_type t3 = prime3_type::mul(
+                    prime3_type::sub(prime3_type::mul(prime3_type::sub(r3[i], t1 % prime3_type::mod), inv_p1_p3), t2 % prime3_type::mod),
+                    inv_p2_p3
+                );
+                unsigned_radix2_type a = static_cast<unsigned_radix2_type>(p1) * t2;
+                unsigned_radix2_type b_lo = static_cast<unsigned_radix2_type>(p1p2_lo) * t3, b_hi = static_cast<unsigned_radix2_type>(p1p2_hi) * t3;
+                unsigned_radix2_type s0 =
+                    static_cast<unsigned_radix2_type>(c0) + t1 + static_cast<radix_type>(a) + static_cast<radix_type>(b_lo);
+                unsigned_radix2_type s1 =
+                    static_cast<unsigned_radix2_type>(c1) + (s0 >> radix_log2) + (a >> radix_log2) + (b_lo >> radix_log2) + static_cast<radix_type>(b_hi);
+                r_container[i] = static_cast<radix_type>(s0);
+                c0 = static_cast<radix_type>(s1);
+                c1 = static_cast<radix_type>((s1 >> radix_log2) + (b_hi >> radix_log2));
             }
-            if(container.size() == 0){ assign(0); }
-            (this->*normalize_container)();
+            r_container[m] = c0;
+            result.normalize_container_impl();
+            return result;
+        }
+
+        static unsigned_integer &div(unsigned_integer &result, unsigned_integer &rem, const unsigned_integer &lhs, const unsigned_integer &rhs){
+            div_impl(result, rem, lhs, rhs);
+            return result;
+        }
+
+        void divexact_radix(radix_type v){
+            kernel_type::divexact_1(&container[0], &container[0], container.size(), v);
+            normalize_container_impl();
+        }
+
+        radix_type div_radix(radix_type v){
+            radix_type r = kernel_type::divrem_1(&container[0], &container[0], container.size(), v);
+            normalize_container_impl();
+            return r;
         }
 
         static void div_impl(unsigned_integer &result, unsigned_integer &rem, const unsigned_integer &a, const unsigned_integer &b){
-            const radix_type half = static_cast<radix_type>(static_cast<radix2_type>(1) << (radix_log2 - 1));
+            unsigned_radix2_type x, y;
+            if(a.small_value(x) && b.small_value(y) && y != 0){
+                unsigned_radix2_type q = x / y, r = x % y;
+                result.assign(q);
+                rem.assign(r);
+                return;
+            }
             if(a == 0 || a < b){
                 rem.assign(a);
                 result.assign(0);
                 return;
             }
-            result = a;
-            unsigned_integer v_prime(b);
-            container_type buffer;
-            radix_type leftmost = v_prime.container.back();
-            std::size_t shift_num = 0;
-            while(leftmost < half){
-                leftmost <<= 1;
-                ++shift_num;
+            std::size_t an = a.container.size(), bn = b.container.size();
+            if(bn == 1){
+                result.assign(a);
+                rem.assign(result.div_radix(b.container[0]));
+                return;
+            }
+            if(bn >= threshold_newton_div && an - bn >= bn / 2){
+                reciprocal(b).div(result, rem, a);
+                return;
+            }
+            std::size_t shift = 0;
+            for(radix_type leftmost = b.container.back(); (leftmost >> (radix_log2 - 1)) == 0; leftmost <<= 1){ ++shift; }
+            scratch_type u(an + 1), v(bn);
+            if(shift > 0){
+                kernel_type::lshift(&v[0], &b.container[0], bn, shift);
+                u[an] = kernel_type::lshift(&u[0], &a.container[0], an, shift);
+            }else{
+                std::copy(b.container.begin(), b.container.end(), v.begin());
+                std::copy(a.container.begin(), a.container.end(), u.begin());
+            }
+            result.container.resize(an + 1 - bn);
+            scratch_type w(bn * 2 + kar_scratch_size(bn, threshold_kar_multi) + 1);
+            limb_div_qr(&result.container[0], &u[0], an + 1, &v[0], bn, &w[0]);
+            result.normalize_container_impl();
+            if(shift > 0){ kernel_type::rshift(&u[0], &u[0], bn, shift); }
+            rem.container.assign(u.begin(), u.begin() + bn);
+            rem.normalize_container_impl();
+        }
+
+        static radix_type limb_div_qr(radix_type *q, radix_type *u, std::size_t un, const radix_type *d, std::size_t dn, radix_type *w){
+            if(dn < threshold_bz_div){
+                return limb_div_basecase(q, u, un, d, dn);
+            }
+            std::size_t qn = un - dn;
+            radix_type qh = kernel_type::cmp(u + qn, d, dn) >= 0 ? 1 : 0;
+            if(qh){ kernel_type::sub_n(u + qn, u + qn, d, dn); }
+            for(std::size_t i = qn; i > 0; ){
+                std::size_t m = i % dn == 0 ? dn : i % dn;
+                i -= m;
+                limb_div_block(q + i, u + i, m, d, dn, w);
+            }
+            return qh;
+        }
+
+        static radix_type limb_div_2n_1n(radix_type *q, radix_type *u, const radix_type *d, std::size_t n, radix_type *w){
+            if(n < threshold_bz_div){
+                return limb_div_basecase(q, u, n * 2, d, n);
+            }
+            std::size_t lo = n / 2, hi = n - lo;
+            radix_type qh = limb_div_block(q + lo, u + lo, hi, d, n, w);
+            limb_div_block(q, u, lo, d, n, w);
+            return qh;
+        }
+
+        static radix_type limb_div_block(radix_type *q, radix_type *u, std::size_t m, const radix_type *d, std::size_t dn, radix_type *w){
+            std::size_t dl = dn - m;
+            radix_type qh = limb_div_2n_1n(q, u + dl, d + dl, m, w), c = 0;
+            if(dl > 0){
+                limb_mul(w, q, m, d, dl, w + dn);
+                c = kernel_type::sub_n(u, u, w, dn);
+                if(qh){ c += kernel_type::sub_n(u + m, u + m, d, dl); }
             }
-            v_prime <<= shift_num;
-            result <<= shift_num;
-            std::size_t s = result.container.size() - v_prime.container.size();
-            rem.div_copy_impl(result, s, s + v_prime.container.size() - 1);
-            if(rem < v_prime){
-                rem.container.insert(rem.container.begin(), result.container[--s]);
+            while(c != 0){
+                qh -= kernel_type::sub_1(q, q, m, 1);
+                c -= kernel_type::add_n(u, u, d, dn);
             }
-            while(rem >= v_prime){
-                buffer.push_back(rem.div_n_digit(v_prime));
-                while(s > 0){
-                    rem.container.insert(rem.container.begin(), result.container[--s]);
-                    if(rem >= v_prime){ break; }
-                    buffer.push_back(0);
+            return qh;
+        }
+
+        static radix_type limb_div_basecase(radix_type *q, radix_type *u, std::size_t un, const radix_type *d, std::size_t dn){
+            std::size_t qn = un - dn;
+            radix_type qh = kernel_type::cmp(u + qn, d, dn) >= 0 ? 1 : 0;
+            if(qh){ kernel_type::sub_n(u + qn, u + qn, d, dn); }
+            if(dn == 1){
+                unsigned_radix2_type r = u[qn];
+                for(std::size_t i = qn; i > 0; --i){
+                    r = (r << radix_log2) | u[i - 1];
+                    q[i - 1] = static_cast<radix_type>(r / d[0]);
+                    r %= d[0];
                 }
+                u[0] = static_cast<radix_type>(r);
+                return qh;
             }
-            result.container.clear();
-            for(std::size_t i = buffer.size(); i > 0; --i){
-                result.container.push_back(buffer[i - 1]);
+            const unsigned_radix2_type mask = static_cast<radix_type>(~static_cast<radix_type>(0));
+            const unsigned_radix2_type d1 = d[dn - 1], d0 = d[dn - 2];
+            for(std::size_t i = qn; i > 0; --i){
+                radix_type *ui = u + (i - 1);
+                unsigned_radix2_type num = (static_cast<unsigned_radix2_type>(ui[dn]) << radix_log2) | ui[dn - 1];
+                unsigned_radix2_type qhat = num / d1, rhat = num % d1;
+                while(qhat > mask || qhat * d0 > ((rhat << radix_log2) | ui[dn - 2])){
+                    --qhat, rhat += d1;
+                    if(rhat > mask){ break; }
+                }
+                radix_type c = kernel_type::submul_1(ui, d, dn, static_cast<radix_type>(qhat));
+                if(ui[dn] < c){
+                    --qhat;
+                    kernel_type::add_n(ui, ui, d, dn);
+                }
+                ui[dn] = 0;
+                q[i - 1] = static_cast<radix_type>(qhat);
+            }
+            return qh;
+        }
+
+        static void limb_mul(radix_type *r, const radix_type *x, std::size_t xn, const radix_type *y, std::size_t yn, radix_type *w){
+            if((std::min)(xn, yn) >= threshold_ntt_multi && ntt_multi_enable(xn, yn)){
+                unsigned_integer a, b, c;
+                a.container.assign(x, x + xn), b.container.assign(y, y + yn);
+                ntt_multi(c, a.container.begin(), a.container.end(), b.container.begin(), b.container.end(), xn, yn);
+                std::copy(c.container.begin(), c.container.end(), r);
+                std::fill(r + c.container.size(), r + (xn + yn), static_cast<radix_type>(0));
+            }else{
+                kar_multi_raw(r, x, xn, y, yn, w);
             }
-            rem >>= shift_num;
         }
 
         static unsigned_integer &div(unsigned_integer &result, const unsigned_integer &lhs, const unsigned_integer &rhs){
@@ -517,66 +1090,25 @@ namespace cpp_multi_precision{
             return rem;
         }
 
-        bool base_less_eq(bool final, typename container_type::const_iterator rhs_it, typename container_type::const_iterator rhs_end) const{
-            std::size_t lhs_n = container.size(), rhs_n = std::distance(rhs_it, rhs_end);
-            typename container_type::const_iterator lhs_begin = container.begin(), lhs_it = lhs_begin;
-            if(lhs_n < rhs_n){
-                std::size_t n = rhs_n - lhs_n;
-                for(std::size_t i = 0; i < n; ++i){
-                    if(*(rhs_it + (rhs_n - i - 1)) > 0){ return true; }
-                }
-                rhs_it += lhs_n - 1;
-                lhs_it = lhs_begin + (lhs_n - 1);
-            }else if(lhs_n > rhs_n){
-                std::size_t n = lhs_n - rhs_n;
-                for(std::size_t i = 0; i < n; ++i){
-                    if(*(container.begin() + (lhs_n - i - 1)) > 0){ return false; }
-                }
-                lhs_it += rhs_n - 1;
-                rhs_it = rhs_it + (rhs_n - 1);
-            }else{
-                lhs_it += lhs_n - 1;
-                rhs_it += lhs_n - 1;
+        int compare(typename container_type::const_iterator rhs_it, typename container_type::const_iterator rhs_end) const{
+            std::size_t lhs_n = container.size(), rhs_n = std::distance(rhs_it, rhs_end), n = (std::min)(lhs_n, rhs_n);
+            if(lhs_n == 1 && rhs_n == 1){
+                radix_type x = container[0], y = *rhs_it;
+                return x < y ? -1 : (x > y ? 1 : 0);
             }
-            for(; ; ){
-                radix_type l = *lhs_it, r = *rhs_it;
-                if(l < r){ return true; }
-                if(l > r){ return false; }
-                if(lhs_begin == lhs_it){ break; }
-                --lhs_it, --rhs_it;
-            }
-            return final;
+            if(lhs_n > n && kernel_type::normalized_size(&container[n], lhs_n - n) > 0){ return 1; }
+            if(rhs_n > n && kernel_type::normalized_size(&*(rhs_it + n), rhs_n - n) > 0){ return -1; }
+            return n > 0 ? kernel_type::cmp(&container[0], &*rhs_it, n) : 0;
+        }
+
+        bool base_less_eq(bool final, typename container_type::const_iterator rhs_it, typename container_type::const_iterator rhs_end) const{
+            int c = compare(rhs_it, rhs_end);
+            return c < 0 || (c == 0 && final);
         }
 
         bool base_greater_eq(bool final, typename container_type::const_iterator rhs_it, typename container_type::const_iterator rhs_end) const{
-            std::size_t lhs_n = container.size(), rhs_n = std::distance(rhs_it, rhs_end);
-            typename container_type::const_iterator lhs_begin = container.begin(), lhs_it = lhs_begin;
-            if(lhs_n < rhs_n){
-                std::size_t n = rhs_n - lhs_n;
-                for(std::size_t i = 0; i < n; ++i){
-                    if(*(rhs_it + (rhs_n - i - 1)) > 0){ return false; }
-                }
-                rhs_it += lhs_n - 1;
-                lhs_it = lhs_begin + (lhs_n - 1);
-            }else if(lhs_n > rhs_n){
-                std::size_t n = lhs_n - rhs_n;
-                for(std::size_t i = 0; i < n; ++i){
-                    if(*(container.begin() + (lhs_n - i - 1)) > 0){ return true; }
-                }
-                lhs_it += rhs_n - 1;
-                rhs_it = rhs_it + (rhs_n - 1);
-            }else{
-                lhs_it += lhs_n - 1;
-                rhs_it += lhs_n - 1;
-            }
-            for(; ; ){
-                radix_type l = *lhs_it, r = *rhs_it;
-                if(l < r){ return false; }
-                if(l > r){ return true; }
-                if(lhs_begin == lhs_it){ break; }
-                --lhs_it, --rhs_it;
-            }
-            return final;
+            int c = compare(rhs_it, rhs_end);
+            return c > 0 || (c == 0 && final);
         }
 
         template<class OtherContainer>
@@ -593,197 +1125,523 @@ namespace cpp_multi_precision{
             }
         }
 
-        template<bool InModular, class Type, class Multi>
-        static Type &pow_impl(Type &result, const Type &x, const Type &y, Multi multi, const Type &mod = 0){
-            result.assign(x);
-            typename container_type::const_reverse_iterator y_iter = y.container.rbegin(); 
-            {
-                radix_type n_y = *y_iter;
-                std::size_t k = 0;
-                for(; (n_y & (1 << (radix_log2 - 1))) == 0; n_y <<= 1){ ++k; }
-                n_y = *y_iter;
-                ++k;
-                for(std::size_t n = k; n < radix_log2; ++n){
-                    std::size_t m = radix_log2 - n - 1;
-                    Type z(result);
-                    multi(result, z, z);
-                    if(((n_y >> m) & 1) == 1){
-                        Type w(result);
-                        multi(result, w, x);
-                        if(InModular){ result = result % mod; }
-                    }
+        template<bool InModular, class Type, class Multi, class Square>
+        static Type &pow_impl(Type &result, const Type &x, const Type &y, Multi multi, Square square, const Type &mod = 0){
+            if(y == 0){
+                result.assign(1);
+                if(InModular){ result = result % mod; }
+                return result;
+            }
+            std::size_t top = y.bit_num(), bits = top + 1;
+            std::size_t k = bits <= 8 ? 1 : bits <= 24 ? 2 : bits <= 80 ? 3 : bits <= 240 ? 4 : bits <= 672 ? 5 : 6;
+            std::vector<Type> table(static_cast<std::size_t>(1) << (k - 1));
+            table[0] = InModular ? x % mod : x;
+            if(k > 1){
+                Type x2;
+                square(x2, table[0]);
+                if(InModular){ x2 = x2 % mod; }
+                for(std::size_t i = 1; i < table.size(); ++i){
+                    multi(table[i], table[i - 1], x2);
+                    if(InModular){ table[i] = table[i] % mod; }
                 }
             }
-            ++y_iter;
-            for(typename container_type::const_reverse_iterator y_end = y.container.rend(); y_iter != y_end; ++y_iter){
-                const radix_type &n_y(*y_iter);
-                for(std::size_t n = 0; n < radix_log2; ++n){
-                    std::size_t m = radix_log2 - n - 1;
-                    Type z(result);
-                    multi(result, z, z);
-                    if(((n_y >> m) & 1) == 1){
-                        Type w(result);
-                        multi(result, w, x);
-                        if(InModular){ result = result % mod; }
+            Type temp;
+            Type *current = &result, *next = &temp;
+            bool first = true;
+            for(std::size_t i = top + 1; i > 0; ){
+                if(y.n_bit(i - 1) == 0){
+                    square(*next, *current);
+                    if(InModular){ *next = *next % mod; }
+                    std::swap(current, next);
+                    --i;
+                    continue;
+                }
+                std::size_t j = i > k ? i - k : 0;
+                while(y.n_bit(j) == 0){ ++j; }
+                std::size_t w = 0;
+                for(std::size_t l = i; l > j; --l){ w = (w << 1) | y.n_bit(l - 1); }
+                if(first){
+                    *current = table[w >> 1];
+                    first = false;
+                }else{
+                    for(std::size_t l = j; l < i; ++l){
+                        square(*next, *current);
+                        if(InModular){ *next = *next % mod; }
+                        std::swap(current, next);
                     }
+                    multi(*next, *current, table[w >> 1]);
+                    if(InModular){ *next = *next % mod; }
+                    std::swap(current, next);
                 }
+                i = j;
             }
+            if(current != &result){ result = std::move(*current); }
             return result;
         }
 
         void bit_shift_lsr(std::size_t n){
             if(*this == 0){ return; }
             std::size_t digit = n / radix_log2, shift = n % radix_log2;
-            std::size_t rev_shift = radix_log2 - shift;
-            radix_type c = 0;
-            for(std::size_t i = 0; i < container.size(); ++i){
-                radix_type x = container[i];
-                container[i] = (x << shift) | c;
-                if(rev_shift < radix_log2){
-                    c = x >> rev_shift;
-                }else{
-                    c = 0;
-                }
-            }
-            if(normalize_container == &unsigned_integer::normalize_container_impl){
-                if(c > 0){ container.push_back(c); }
-            }else{
-                container.back() = c;
-            }
+            radix_type c = shift > 0 ? kernel_type::lshift(&container[0], &container[0], container.size(), shift) : 0;
+            if(c > 0){ container.push_back(c); }
             radix_shift(digit);
         }
 
         void bit_shift_rsl(std::size_t n){
             if(*this == 0){ return; }
             std::size_t digit = n / radix_log2, shift = n % radix_log2;
-            std::size_t size = container.size(), rev_shift = radix_log2 - shift;
+            std::size_t size = container.size(), m = digit < size ? size - digit : 0;
             if(digit > 0){
-                for(std::size_t i = 0, length = size - digit; i < length; ++i){
-                    container[i] = container[i + digit];
+                std::copy(container.begin() + (size - m), container.end(), container.begin());
+                std::fill(container.begin() + m, container.end(), 0);
+            }
+            if(shift > 0 && m > 0){ kernel_type::rshift(&container[0], &container[0], m, shift); }
+            normalize_container_impl();
+        }
+
+        static void sqrtrem_rec(unsigned_integer &s, unsigned_integer &r, const unsigned_integer &a){
+            std::size_t m = a.container.size() / 2;
+            if(m <= 1){
+                unsigned_radix2_type v = a.container[0], u;
+                if(a.container.size() > 1){ v |= static_cast<unsigned_radix2_type>(a.container[1]) << radix_log2; }
+                u = isqrt(v);
+                s.assign(u), r.assign(v - u * u);
+                return;
+            }
+            std::size_t l = m / 2;
+            unsigned_integer sh, rh, a1(a.container.begin() + l, a.container.begin() + l * 2), a0(a.container.begin(), a.container.begin() + l);
+            sqrtrem_rec(sh, rh, unsigned_integer(a.container.begin() + l * 2, a.container.end()));
+            rh <<= l * radix_log2, rh += a1;
+            unsigned_integer q, u, q2;
+            div(q, u, rh, sh << 1);
+            s = sh << (l * radix_log2), s += q;
+            u <<= l * radix_log2, u += a0;
+            square(q2, q);
+            if(u >= q2){
+                r = u - q2;
+            }else{
+                q2 -= u;
+                r = s << 1, r -= q2, r -= 1;
+                s -= 1;
+            }
+        }
+
+        static void root_rec(unsigned_integer &x, unsigned_integer &pk, const unsigned_integer &a, std::size_t k){
+            std::size_t rb = a.bit_num() / k + 1;
+            if(rb <= radix_log2){
+                unsigned_radix2_type e = root_estimate(a, k);
+                x.assign((std::min)(e + (e >> 20) + 2, static_cast<unsigned_radix2_type>(1) << rb));
+            }else{
+                std::size_t h = rb / 2;
+                root_rec(x, pk, a >> (k * h), k);
+                x += 1, x <<= h;
+            }
+            unsigned_integer pw, q, r, y, km1(static_cast<unsigned_radix2_type>(k - 1));
+            for(bool first = true; ; first = false){
+                pow(pw, x, km1);
+                if(!first){
+                    limb_multi(pk, pw, x);
+                    if(pk <= a){ break; }
                 }
-                for(std::size_t i = 0; i < digit; ++i){
-                    container[size - i - 1] = 0;
+                std::size_t t = pw.container.size() > x.container.size() + 2 ? pw.container.size() - x.container.size() - 2 : 0;
+                if(pw.container.size() > a.container.size()){ q = 0; }
+                else{ div(q, r, unsigned_integer(a.container.begin() + t, a.container.end()), unsigned_integer(pw.container.begin() + t, pw.container.end())); }
+                multi(y, x, k - 1);
+                y += q, y += 1;
+                y.div_radix(static_cast<radix_type>(k));
+                if(y >= x){
+                    if(first){ continue; }
+                    y = x - 1;
                 }
+                x = std::move(y);
             }
-            radix_type c = 0;
-            for(std::size_t i = 0; i < container.size(); ++i){
-                std::size_t j = size - i - 1;
-                radix_type x = container[j];
-                container[j] = (x >> shift) | c;
-                if(rev_shift < radix_log2){
-                    c = x << rev_shift;
-                }else{
-                    c = 0;
+        }
+
+        static unsigned_radix2_type root_estimate(const unsigned_integer &a, std::size_t k){
+            std::size_t n = a.container.size();
+            long double t = 0;
+            for(std::size_t i = 0; i < 3 && i < n; ++i){
+                t += std::ldexp(static_cast<long double>(a.container[n - i - 1]), -static_cast<int>(radix_log2 * i));
+            }
+            long double l = (std::log2(t) + static_cast<long double>(radix_log2 * (n - 1))) / k;
+            return static_cast<unsigned_radix2_type>(std::floor(std::exp2(l) + 0.5L));
+        }
+
+        static bool is_perfect_power_impl(const unsigned_integer &a, bool odd){
+            if(a <= 1){ return true; }
+            std::size_t b = a.bit_num() + 1, v = 0;
+            for(; a.n_bit(v) == 0; ++v);
+            const unsigned_radix2_type q0 = (static_cast<unsigned_radix2_type>(1) << (radix_log2 - 1)) - 1, q_max = static_cast<unsigned_radix2_type>(1) << (radix_log2 - 1);
+            unsigned_radix2_type a_q0 = mod_radix(a, q0);
+            std::vector<bool> composite(b, false);
+            for(std::size_t p = 2; p < b; ++p){
+                if(composite[p]){ continue; }
+                for(std::size_t j = p * p; j < b; j += p){ composite[j] = true; }
+                if((v > 0 && v % p != 0) || (odd && p == 2)){ continue; }
+                if(p == 2){
+                    if(is_perfect_square(a)){ return true; }
+                    continue;
+                }
+                if(b / p + 1 <= 40){
+                    unsigned_radix2_type x = root_estimate(a, p);
+                    if(x < 2 || pow_mod_radix(x % q0, p, q0) != a_q0){ continue; }
+                    unsigned_integer y;
+                    pow(y, unsigned_integer(x), unsigned_integer(static_cast<unsigned_radix2_type>(p)));
+                    if(y == a){ return true; }
+                    continue;
+                }
+                bool reject = false;
+                for(unsigned_radix2_type q = 2 * p + 1, found = 0; found < (p < 8 ? 4 : 2) && q < q_max && !reject; q += 2 * p){
+                    if(!aux::prime_div_test(q)){ continue; }
+                    ++found;
+                    unsigned_radix2_type r = mod_radix(a, q);
+                    reject = r != 0 && pow_mod_radix(r, (q - 1) / p, q) != 1;
                 }
+                if(reject){ continue; }
+                unsigned_integer x, rem;
+                rootrem(x, rem, a, p);
+                if(rem == 0){ return true; }
             }
-            (this->*normalize_container)();
+            return false;
+        }
+
+        static unsigned_radix2_type mod_radix(const unsigned_integer &a, unsigned_radix2_type q){
+            unsigned_radix2_type r = 0;
+            for(std::size_t i = a.container.size(); i > 0; --i){
+                r = ((r << radix_log2) | a.container[i - 1]) % q;
+            }
+            return r;
+        }
+
+        static unsigned_radix2_type pow_mod_radix(unsigned_radix2_type x, unsigned_radix2_type e, unsigned_radix2_type q){
+            unsigned_radix2_type r = 1 % q;
+            for(x %= q; e > 0; e >>= 1, x = x * x % q){
+                if((e & 1) == 1){ r = r * x % q; }
+            }
+            return r;
+        }
+
+        static unsigned_radix2_type isqrt(unsigned_radix2_type v){
+            if(v == 0){ return 0; }
+            std::size_t n = 0;
+            for(unsigned_radix2_type t = v; t > 0; t >>= 1){ ++n; }
+            unsigned_radix2_type x = static_cast<unsigned_radix2_type>(1) << ((n + 1) / 2), y = (x + v / x) / 2;
+            for(; y < x; y = (x + v / x) / 2){ x = y; }
+            return x;
+        }
+
+        static bool is_square_residue(const unsigned long long *mask, unsigned_radix2_type r){
+            return ((mask[static_cast<std::size_t>(r >> 6)] >> (r & 63)) & 1) != 0;
         }
 
         static unsigned_integer &gcd_impl(unsigned_integer &result, unsigned_integer lhs, unsigned_integer rhs){
-            if(rhs == 0){ result = 0; return result; }
-            unsigned_integer *operands[3] = { &lhs, &rhs, &result };
-            for(; ; ){
-                mod(*operands[2], *operands[0], *operands[1]);
-                if(*operands[2] == 0){ break; }
-                unsigned_integer *ptr = operands[0];
-                for(int i = 0; i < 2; ++i){ operands[i] = operands[i + 1]; }
-                operands[2] = ptr;
+            if(rhs == 0){ result = lhs; return result; }
+            while(rhs.container.size() >= threshold_hgcd){
+                hgcd_matrix m;
+                if(!hgcd(m, lhs, rhs, false)){ euclid_step(m, lhs, rhs); }
+                if(rhs == 0){
+                    result = std::move(lhs);
+                    return result;
+                }
+            }
+            unsigned_integer c, d;
+            unsigned_integer *a = &lhs, *b = &rhs, *t = &c, *u = &d;
+            while(b->container.size() > 2){
+                if(lehmer_step(*t, *u, *a, *b)){
+                    std::swap(a, t), std::swap(b, u);
+                    if(*a < *b){ std::swap(a, b); }
+                }else{
+                    mod(*t, *a, *b);
+                    std::swap(a, b), std::swap(b, t);
+                }
+                if(*b == 0){
+                    result = std::move(*a);
+                    return result;
+                }
             }
-            if(operands[1] != &result){ result.assign(*operands[1]); }
+            if(a->container.size() > 2){
+                mod(*t, *a, *b);
+                std::swap(a, t);
+            }
+            result.assign(binary_gcd(a->low_radix2(), b->low_radix2()));
             return result;
         }
 
+        unsigned_radix2_type low_radix2() const{
+            unsigned_radix2_type v = container[0];
+            if(container.size() > 1){ v |= static_cast<unsigned_radix2_type>(container[1]) << radix_log2; }
+            return v;
+        }
+
+        static unsigned_radix2_type binary_gcd(unsigned_radix2_type u, unsigned_radix2_type v){
+            if(u == 0){ return v; }
+            if(v == 0){ return u; }
+            std::size_t shift = 0;
+            for(; ((u | v) & 1) == 0; u >>= 1, v >>= 1){ ++shift; }
+            while((u & 1) == 0){ u >>= 1; }
+            do{
+                while((v & 1) == 0){ v >>= 1; }
+                if(u > v){ std::swap(u, v); }
+                v -= u;
+            }while(v != 0);
+            return u << shift;
+        }
+
+        static radix2_type lehmer_window(const container_type &c, std::size_t s){
+            std::size_t li = s / radix_log2, bo = s % radix_log2, n = c.size();
+            unsigned_radix2_type l0 = li < n ? c[li] : 0, l1 = li + 1 < n ? c[li + 1] : 0, l2 = li + 2 < n ? c[li + 2] : 0;
+            unsigned_radix2_type v = ((l1 << radix_log2) | l0) >> bo;
+            if(bo > 0){ v |= l2 << (radix2_log2 - bo); }
+            return static_cast<radix2_type>(v);
+        }
+
+        static radix2_type lehmer_quotient(radix2_type a, radix2_type b){
+            radix2_type q = 0;
+            for(; a >= b && q < 4; a -= b){ ++q; }
+            return a >= b ? q + a / b : q;
+        }
+
+        static void gcdext_impl(unsigned_integer &result, unsigned_integer &u, unsigned_integer &v, bool &neg, unsigned_integer a, unsigned_integer b){
+            hgcd_matrix m;
+            while(b.container.size() >= threshold_hgcd){
+                hgcd_matrix r;
+                if(hgcd(r, a, b)){
+                    m.multi(r);
+                }else{
+                    euclid_step(m, a, b);
+                }
+            }
+            while(b != 0){
+                if(b.container.size() <= 2 || !lehmer_matrix_step(m, a, b)){ euclid_step(m, a, b); }
+            }
+            result = std::move(a), u = std::move(m.m11), v = std::move(m.m01), neg = m.neg;
+        }
+
+        struct hgcd_matrix{
+            hgcd_matrix() : m00(1), m01(0), m10(0), m11(1), neg(false){}
+
+            void quotient(const unsigned_integer &q){
+                unsigned_integer t0 = m00 * q + m01, t1 = m10 * q + m11;
+                m01 = std::move(m00), m11 = std::move(m10);
+                m00 = std::move(t0), m10 = std::move(t1);
+                neg = !neg;
+            }
+
+            bool identity() const{
+                return m01 == 0 && m10 == 0 && m00 == 1 && m11 == 1;
+            }
+
+            void swap_columns(){
+                std::swap(m00, m01), std::swap(m10, m11);
+                neg = !neg;
+            }
+
+            void multi(const hgcd_matrix &other){
+                unsigned_integer t00 = m00 * other.m00 + m01 * other.m10, t01 = m00 * other.m01 + m01 * other.m11;
+                unsigned_integer t10 = m10 * other.m00 + m11 * other.m10, t11 = m10 * other.m01 + m11 * other.m11;
+                m00 = std::move(t00), m01 = std::move(t01), m10 = std::move(t10), m11 = std::move(t11);
+                neg = neg != other.neg;
+            }
+
+            static void lehmer_row(unsigned_integer &u, unsigned_integer &v, radix_type c00, radix_type c01, radix_type c10, radix_type c11){
+                std::size_t n = (std::max)(u.container.size(), v.container.size());
+                u.container.resize(n, 0), v.container.resize(n, 0);
+                container_type nu(n + 1), nv(n + 1);
+                nu[n] = kernel_type::mul_1(&nu[0], &u.container[0], n, c00);
+                nu[n] += kernel_type::addmul_1(&nu[0], &v.container[0], n, c10);
+                nv[n] = kernel_type::mul_1(&nv[0], &u.container[0], n, c01);
+                nv[n] += kernel_type::addmul_1(&nv[0], &v.container[0], n, c11);
+                u.container.swap(nu), v.container.swap(nv);
+                u.normalize_container_impl(), v.normalize_container_impl();
+            }
+
+            unsigned_integer m00, m01, m10, m11;
+            bool neg;
+        };
+
+        static bool hgcd(hgcd_matrix &m, unsigned_integer &a, unsigned_integer &b, bool matrix = true){
+            std::size_t n = a.container.size(), s = n / 2 + 1;
+            if(b.container.size() <= s){ return false; }
+            bool progress = false;
+            if(n >= threshold_hgcd){
+                progress = hgcd_reduce(m, a, b, n / 2, matrix);
+                for(std::size_t n2 = n * 3 / 4 + 1; a.container.size() > n2 && b.container.size() > s; progress = true){
+                    if(!lehmer_matrix_step(m, a, b)){ euclid_step(m, a, b); }
+                }
+                std::size_t k = a.container.size();
+                if(b.container.size() > s && k > s + 2){
+                    progress = hgcd_reduce(m, a, b, 2 * s - k + 1, matrix) || progress;
+                }
+            }
+            for(; b.container.size() > s; progress = true){
+                if(b.container.size() <= s + 2 || !lehmer_matrix_step(m, a, b)){ euclid_step(m, a, b); }
+            }
+            return progress;
+        }
+
+        static bool hgcd_reduce(hgcd_matrix &m, unsigned_integer &a, unsigned_integer &b, std::size_t p, bool matrix){
+            if(b.container.size() <= p){ return false; }
+            unsigned_integer ah(a.container.begin() + p, a.container.end()), bh(b.container.begin() + p, b.container.end());
+            hgcd_matrix r;
+            if(!hgcd(r, ah, bh)){ return false; }
+            unsigned_integer al(a.container.begin(), a.container.begin() + p), bl(b.container.begin(), b.container.begin() + p);
+            unsigned_integer x = r.m11 * al, y = r.m01 * bl, z = r.m00 * bl, w = r.m10 * al;
+            if(r.neg){ std::swap(x, y), std::swap(z, w); }
+            ah.radix_shift(p), bh.radix_shift(p);
+            if(!hgcd_adjust(ah, x, y) || !hgcd_adjust(bh, z, w) || ah < bh){ return false; }
+            a = std::move(ah), b = std::move(bh);
+            if(!matrix){ return true; }
+            if(m.identity()){
+                m = std::move(r);
+            }else{
+                m.multi(r);
+            }
+            return true;
+        }
+
+        static bool hgcd_adjust(unsigned_integer &h, unsigned_integer &x, const unsigned_integer &y){
+            if(x >= y){
+                x -= y;
+                h += x;
+                return true;
+            }
+            unsigned_integer d = y - x;
+            if(h < d){ return false; }
+            h -= d;
+            return true;
+        }
+
+        static void euclid_step(hgcd_matrix &m, unsigned_integer &a, unsigned_integer &b){
+            const std::size_t window = radix2_log2 - 2;
+            std::size_t h = a.bit_num() + 1, an = a.container.size(), bn = b.container.size();
+            radix2_type x = h > window ? lehmer_window(a.container, h - window) : 0, y = h > window ? lehmer_window(b.container, h - window) : 0;
+            unsigned_integer q, r;
+            if(y >= (static_cast<radix2_type>(1) << (radix_log2 - 1))){
+                radix_type d = static_cast<radix_type>(x / (y + 1));
+                r = a;
+                radix_type c = kernel_type::submul_1(&r.container[0], &b.container[0], bn, d);
+                if(an > bn){ kernel_type::sub_1(&r.container[bn], &r.container[bn], an - bn, c); }
+                r.normalize_container_impl();
+                for(; r >= b; ++d){ r -= b; }
+                q.assign(static_cast<unsigned_radix2_type>(d));
+            }else{
+                div(q, r, a, b);
+            }
+            m.quotient(q);
+            a = std::move(b), b = std::move(r);
+        }
+
+        static bool lehmer_matrix_step(hgcd_matrix &m, unsigned_integer &a, unsigned_integer &b){
+            radix2_type p0, q0, p1, q1;
+            if(!lehmer_cofactors(a, b, p0, q0, p1, q1)){ return false; }
+            unsigned_integer na, nb;
+            lehmer_apply(na, nb, a, b, p0, q0, p1, q1);
+            radix_type
+                c00 = static_cast<radix_type>(q1 < 0 ? -q1 : q1), c01 = static_cast<radix_type>(q0 < 0 ? -q0 : q0),
+                c10 = static_cast<radix_type>(p1 < 0 ? -p1 : p1), c11 = static_cast<radix_type>(p0 < 0 ? -p0 : p0);
+            hgcd_matrix::lehmer_row(m.m00, m.m01, c00, c01, c10, c11);
+            hgcd_matrix::lehmer_row(m.m10, m.m11, c00, c01, c10, c11);
+            m.neg = m.neg != (q1 < 0);
+            a = std::move(na), b = std::move(nb);
+            if(a < b){
+                std::swap(a, b);
+                m.swap_columns();
+            }
+            return true;
+        }
+
+        static bool lehmer_step(unsigned_integer &na, unsigned_integer &nb, unsigned_integer &a, unsigned_integer &b){
+            radix2_type p0, q0, p1, q1;
+            if(!lehmer_cofactors(a, b, p0, q0, p1, q1)){ return false; }
+            lehmer_apply(na, nb, a, b, p0, q0, p1, q1);
+            return true;
+        }
+
+        static bool lehmer_cofactors(const unsigned_integer &a, const unsigned_integer &b, radix2_type &p0, radix2_type &q0, radix2_type &p1, radix2_type &q1){
+            const std::size_t window = radix2_log2 - 2;
+            const radix2_type limit = (static_cast<radix2_type>(1) << (radix_log2 - 1)) - 1;
+            std::size_t h = a.bit_num() + 1;
+            radix2_type x = lehmer_window(a.container, h - window), y = lehmer_window(b.container, h - window);
+            p0 = 1, q0 = 0, p1 = 0, q1 = 1;
+            for(; ; ){
+                if(y + p1 <= 0 || y + q1 <= 0){ break; }
+                radix2_type q = lehmer_quotient(x + p0, y + p1);
+                if(q <= (limit >> 2)){
+                    radix2_type t = x + q0 - q * (y + q1);
+                    if(t < 0 || t >= y + q1){ break; }
+                }else if(q > limit || q != lehmer_quotient(x + q0, y + q1)){ break; }
+                radix2_type np = p0 - q * p1, nq = q0 - q * q1;
+                if(np > limit || -np > limit || nq > limit || -nq > limit){ break; }
+                p0 = p1, p1 = np, q0 = q1, q1 = nq;
+                radix2_type ny = x - q * y;
+                x = y, y = ny;
+            }
+            return q0 != 0;
+        }
+
+        static void lehmer_apply(unsigned_integer &na, unsigned_integer &nb, unsigned_integer &a, unsigned_integer &b, radix2_type p0, radix2_type q0, radix2_type p1, radix2_type q1){
+            std::size_t n = a.container.size();
+            b.container.resize(n, 0);
+            na.container.resize(n), nb.container.resize(n);
+            lehmer_combine(&na.container[0], &a.container[0], &b.container[0], n, p0, q0);
+            lehmer_combine(&nb.container[0], &a.container[0], &b.container[0], n, p1, q1);
+            na.normalize_container_impl(), nb.normalize_container_impl();
+        }
+
+        static void lehmer_combine(radix_type *r, const radix_type *a, const radix_type *b, std::size_t n, radix2_type p, radix2_type q){
+            if(q <= 0){
+                kernel_type::mul_1(r, a, n, static_cast<radix_type>(p));
+                kernel_type::submul_1(r, b, n, static_cast<radix_type>(-q));
+            }else{
+                kernel_type::mul_1(r, b, n, static_cast<radix_type>(q));
+                kernel_type::submul_1(r, a, n, static_cast<radix_type>(-p));
+            }
+        }
+
         unsigned_integer &add_range(const typename container_type::const_iterator &first, const typename container_type::const_iterator &last){
             std::size_t rhs_size = std::distance(first, last);
-            if(normalize_container == &unsigned_integer::normalize_container_impl && container.size() < rhs_size + 1){
-                container.resize(rhs_size + 1);
-            }
-            typename container_type::iterator operand_it = container.begin();
-            unsigned_radix2_type c = 0;
-            typename container_type::const_iterator it = first, end = last;
-            for(; it != end; ++it, ++operand_it){
-                radix_type &operand(*operand_it);
-                unsigned_radix2_type temp = static_cast<unsigned_radix2_type>(operand) + static_cast<unsigned_radix2_type>(*it) + c;
-                operand = static_cast<radix_type>(temp % (static_cast<unsigned_radix2_type>(1) << radix_log2));
-                c = temp >> radix_log2;
-            }
-            for(; c > 0; ++operand_it){
-                radix_type &operand(*operand_it);
-                unsigned_radix2_type temp = static_cast<unsigned_radix2_type>(operand) + c;
-                operand = static_cast<radix_type>(temp % (static_cast<unsigned_radix2_type>(1) << radix_log2));
-                c = temp >> radix_log2;
-            }
-            (this->*normalize_container)();
+            if(container.size() < rhs_size){
+                container.resize(rhs_size, 0);
+            }
+            radix_type *p = &container[0];
+            radix_type c = kernel_type::add_n(p, p, &*first, rhs_size);
+            c = kernel_type::incr(p + rhs_size, container.size() - rhs_size, c);
+            if(c > 0){ container.push_back(c); }
+            normalize_container_impl();
             return *this;
         }
 
         unsigned_integer &sub_range(const typename container_type::const_iterator &first, const typename container_type::const_iterator &last){
-            typename container_type::iterator operand_it = container.begin();
-            radix2_type c = 0;
-            typename container_type::const_iterator it = first;
-            for(; it != last; ++it, ++operand_it){
-                radix_type &operand(*operand_it);
-                radix2_type temp = static_cast<radix2_type>(operand) - static_cast<radix2_type>(*it) + c;
-                if(temp < 0){
-                    c = -(((-temp) >> radix_log2) + (((-temp) % (static_cast<radix2_type>(1) << radix_log2)) ? 1 : 0));
-                    temp = (temp + (static_cast<radix2_type>(1) << radix_log2)) % (static_cast<radix2_type>(1) << radix_log2);
-                }else{ c = 0; }
-                operand = static_cast<radix_type>(temp);
-            }
-            if(c != 0){
-                radix_type &operand(*operand_it);
-                operand = static_cast<radix_type>(c + operand);
-            }
-            (this->*normalize_container)();
+            std::size_t rhs_size = std::distance(first, last);
+            radix_type *p = &container[0];
+            radix_type c = kernel_type::sub_n(p, p, &*first, rhs_size);
+            kernel_type::decr(p + rhs_size, container.size() - rhs_size, c);
+            normalize_container_impl();
             return *this;
         }
 
-        void sub_q_n(typename container_type::const_iterator rhs_begin, typename container_type::const_iterator rhs_end, radix2_type q, std::size_t n){
-            typename container_type::iterator operand_it = container.begin();
-            std::advance(operand_it, n);
-            radix2_type c = 0;
-            typename container_type::const_iterator it = rhs_begin, end = rhs_end;
-            for(; it != end; ++it, ++operand_it){
-                radix_type &operand(*operand_it);
-                radix2_type temp = static_cast<radix2_type>(operand) - static_cast<radix2_type>(*it) * q + c;
-                if(temp < 0){
-                    temp = -temp;
-                    c = -(temp / (static_cast<radix2_type>(1) << radix_log2) + (temp % (static_cast<radix2_type>(1) << radix_log2) ? 1 : 0));
-                    temp = (static_cast<radix2_type>(1) << radix_log2) - (temp % (static_cast<radix2_type>(1) << radix_log2));
-                }else{ c = 0; }
-                operand = static_cast<radix_type>(temp);
-            }
-            if(c != 0){
-                radix_type &operand(*operand_it);
-                operand = static_cast<radix_type>(static_cast<radix2_type>(operand) + c);
-            }
-            (this->*normalize_container)();
+        void sub_q_n(typename container_type::const_iterator rhs_begin, typename container_type::const_iterator rhs_end, radix_type q, std::size_t n){
+            std::size_t rhs_size = std::distance(rhs_begin, rhs_end);
+            radix_type *p = &container[0] + n;
+            radix_type c = kernel_type::submul_1(p, &*rhs_begin, rhs_size, q);
+            kernel_type::decr(p + rhs_size, container.size() - n - rhs_size, c);
+            normalize_container_impl();
         }
 
-        void sub_q_n(const unsigned_integer &rhs, radix2_type q, std::size_t n){
+        void sub_q_n(const unsigned_integer &rhs, radix_type q, std::size_t n){
             return sub_q_n(rhs.container.begin(), rhs.container.end(), q, n);
         }
 
         template<class Iter>
         void add_iterator_n(const Iter &rhs_first, const Iter &rhs_last, std::size_t n){
-            std::size_t rhs_container_size = std::distance(rhs_first, rhs_last);
-            if(container.size() < rhs_container_size + n){ container.resize(rhs_container_size + n); }
-            typename container_type::iterator operand_it = container.begin() + n;
-            unsigned_radix2_type c = 0;
-            Iter it = rhs_first, end = rhs_last; --end;
-            for(; it != end; ++it, ++operand_it){
-                radix_type &operand(*operand_it);
-                unsigned_radix2_type temp = static_cast<unsigned_radix2_type>(operand) + static_cast<unsigned_radix2_type>(*it) + c;
-                operand = static_cast<radix_type>(temp % (static_cast<unsigned_radix2_type>(1) << radix_log2));
-                c = temp >> radix_log2;
-            }
-            {
-                radix_type &operand(*operand_it);
-                unsigned_radix2_type temp = static_cast<unsigned_radix2_type>(operand) + static_cast<unsigned_radix2_type>(*it) + c;
-                operand = static_cast<radix_type>(temp % (static_cast<unsigned_radix2_type>(1) << radix_log2));
-                c = temp >> radix_log2;
-                if(c != 0){ container.push_back(static_cast<radix_type>(c)); }
-            }
+            add_limbs_n(&*rhs_first, std::distance(rhs_first, rhs_last), n);
+        }
+
+        void add_limbs_n(const radix_type *b, std::size_t bn, std::size_t n){
+            if(container.size() < bn + n){ container.resize(bn + n); }
+            radix_type *p = &container[0] + n;
+            radix_type c = kernel_type::add_n(p, p, b, bn);
+            if(kernel_type::incr(p + bn, container.size() - n - bn, c) > 0){ container.push_back(1); }
         }
 
         void add_radix_n(const unsigned_integer &rhs, std::size_t n){
@@ -791,70 +1649,152 @@ namespace cpp_multi_precision{
         }
 
         void add_radix_n(unsigned_radix2_type v, std::size_t n){
+            radix_type b[2] = { static_cast<radix_type>(v), static_cast<radix_type>(v >> radix_log2) };
             if(container.size() < n){ container.resize(n); }
-            typename container_type::iterator operand_it = container.begin();
-            std::advance(operand_it, n);
-            unsigned_radix2_type c = v;
-            for(; c > 0; ++operand_it){
-                if(operand_it == container.end()){
-                    container.push_back(0);
-                    operand_it = container.end(), --operand_it;
-                }
-                radix_type &operand(*operand_it);
-                unsigned_radix2_type temp = static_cast<unsigned_radix2_type>(operand) + c;
-                operand = static_cast<radix_type>(temp % (static_cast<unsigned_radix2_type>(1) << radix_log2));
-                c = temp >> radix_log2;
+            add_limbs_n(b, b[1] != 0 ? 2 : (b[0] != 0 ? 1 : 0), n);
+        }
+
+        bool small_value(unsigned_radix2_type &v) const{
+            std::size_t n = container.size();
+            if(n == 1){
+                v = container[0];
+            }else if(n == 2){
+                v = (static_cast<unsigned_radix2_type>(container[1]) << radix_log2) | container[0];
+            }else{
+                return false;
             }
+            return true;
         }
 
         void normalize_container_impl(){
-            while(container.size() > 1 && container.back() == 0){
-                container.pop_back();
+            std::size_t n = container.size();
+            if(n > 1 && container.back() == 0){
+                container.resize((std::max)(kernel_type::normalized_size(&container[0], n), static_cast<std::size_t>(1)));
             }
         }
 
         template<class Ptr, class Char>
         void read_impl(const Ptr &str, int zero, int nine, const Ptr &delim = Ptr()){
-            assign(0);
-            unsigned_integer a(1), t;
-            Ptr it = aux::reading_str_rbegin<Ptr, Char>(str, zero, nine, delim);
-            do{
+            std::pair<radix_type, std::size_t> chunk(decimal_chunk());
+            scratch_type chunks;
+            radix_type v = 0, p = 1;
+            std::size_t n = 0;
+            for(Ptr it = aux::reading_str_rbegin<Ptr, Char>(str, zero, nine, delim); ; --it){
                 int c = *it;
-                if(c >= zero && c <= nine){
-                    *this += multi(t, a, static_cast<radix_type>(c - zero));
-                }else{
-                    break;
+                if(c < zero || c > nine){ break; }
+                v += static_cast<radix_type>(c - zero) * p, p *= 10;
+                if(++n == chunk.second){
+                    chunks.push_back(v);
+                    v = 0, p = 1, n = 0;
                 }
-                --it;
-                t.assign(a);
-                multi(a, t, 10);
-            }while(it != str);
-            {
-                int c = *it;
-                if(c >= zero && c <= nine){
-                    *this += multi(t, a, static_cast<radix_type>(c - zero));
-                    t.assign(a);
-                    multi(a, t, 10);
+                if(it == str){ break; }
+            }
+            if(n > 0){ chunks.push_back(v); }
+            if(chunks.empty()){
+                assign(0);
+            }else{
+                decimal_combine(*this, &chunks[0], chunks.size());
+            }
+        }
+
+        static void decimal_combine(unsigned_integer &result, const radix_type *chunks, std::size_t n){
+            if(n < threshold_read){
+                const radix_type base = decimal_chunk().first;
+                container_type &r_container(result.container);
+                r_container.assign(n, 0);
+                radix_type *r = &r_container[0];
+                std::size_t m = 0;
+                for(std::size_t i = n; i > 0; --i){
+                    radix_type c = kernel_type::mul_1(r, r, m, base);
+                    c += kernel_type::add_1(r, r, m, chunks[i - 1]);
+                    if(c != 0){ r[m++] = c; }
                 }
+                r_container.resize((std::max)(m, static_cast<std::size_t>(1)));
+                result.normalize_container_impl();
+                return;
             }
+            std::size_t k = 0;
+            while((static_cast<std::size_t>(2) << k) < n){ ++k; }
+            std::size_t low = static_cast<std::size_t>(1) << k;
+            unsigned_integer hi, lo;
+            decimal_combine(hi, chunks + low, n - low);
+            decimal_combine(lo, chunks, low);
+            limb_multi(result, hi, decimal_power(k));
+            result += lo;
         }
 
         template<class String, class Char>
         String to_string_impl(int zero) const{
             String result;
             if(*this == 0){ result = static_cast<Char>(zero); return std::move(result); }
-            unsigned_integer a(10), temp[2], r;
-            temp[0].assign(*this);
-            for(; !(temp[0] == 0); ){
-                div(temp[1], r, temp[0], a);
-                temp[0].assign(temp[1]);
-                result.insert(result.begin(), static_cast<Char>(r.container[0] + zero));
-            }
+            std::vector<const unsigned_integer*> powers;
+            do{
+                powers.push_back(&decimal_power(powers.size()));
+            }while(*powers.back() <= *this);
+            std::size_t k = powers.size() - 1;
+            result.assign(decimal_chunk().second << k, static_cast<Char>(zero));
+            to_string_rec<Char>(&result[0], result.size(), *this, powers, k, zero);
+            std::size_t i = 0;
+            while(result[i] == static_cast<Char>(zero)){ ++i; }
+            result.erase(0, i);
             return std::move(result);
         }
 
+        template<class Char>
+        static void to_string_rec(Char *out, std::size_t width, const unsigned_integer &x, const std::vector<const unsigned_integer*> &powers, std::size_t k, int zero){
+            if(k == 0 || x.container.size() < threshold_to_string){
+                std::pair<radix_type, std::size_t> chunk(decimal_chunk());
+                unsigned_integer t(x);
+                Char *p = out + width;
+                while(t != 0){
+                    radix_type r = t.div_radix(chunk.first);
+                    for(std::size_t i = 0; i < chunk.second; ++i){
+                        *--p = static_cast<Char>(zero + r % 10);
+                        r /= 10;
+                    }
+                }
+                return;
+            }
+            unsigned_integer q, r;
+            div(q, r, x, *powers[k - 1]);
+            std::size_t half = width / 2;
+            to_string_rec<Char>(out, width - half, q, powers, k - 1, zero);
+            to_string_rec<Char>(out + (width - half), half, r, powers, k - 1, zero);
+        }
+
+        static std::pair<radix_type, std::size_t> decimal_chunk(){
+            const unsigned_radix2_type max = (static_cast<unsigned_radix2_type>(1) << radix_log2) - 1;
+            unsigned_radix2_type p = 1;
+            std::size_t n = 0;
+            for(; p <= max / 10; p *= 10){ ++n; }
+            return std::make_pair(static_cast<radix_type>(p), n);
+        }
+
+        static const unsigned_integer &decimal_power(std::size_t k){
+            static std::mutex mutex;
+            static std::deque<unsigned_integer> cache;
+            std::lock_guard<std::mutex> lock(mutex);
+            if(cache.empty()){ cache.push_back(unsigned_integer(decimal_chunk().first)); }
+            while(cache.size() <= k){
+                unsigned_integer p;
+                square(p, cache.back());
+                cache.push_back(std::move(p));
+            }
+            return cache[k];
+        }
+
     protected:
-        void (unsigned_integer::*normalize_container)();
+        static const std::size_t threshold_kar_multi = 32;
+        static const std::size_t threshold_kar_square = 48;
+        static const std::size_t threshold_bz_div = 48;
+        static const std::size_t threshold_divexact = 320;
+        static const std::size_t threshold_newton_div = 16384;
+        static const std::size_t threshold_ntt_multi = 2048;
+        static const std::size_t threshold_ntt_square = 2048;
+        static const std::size_t threshold_to_string = 32;
+        static const std::size_t threshold_read = 32;
+        static const std::size_t threshold_hgcd = 1536;
+
         container_type container;
     };
 
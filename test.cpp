@@ -1,9 +1,13 @@
 ﻿#include <iostream>
 #include <vector>
+#include <thread>
 #include "cpp_multi_precision/modular.hpp"
 #include "cpp_multi_precision/sparse_poly.hpp"
 #include "cpp_multi_precision/rational.hpp"
 #include "cpp_multi_precision/integer.hpp"
+#include "cpp_multi_precision/storaged_container.hpp"
+#include "cpp_multi_precision/pool_allocator.hpp"
+#include "cpp_multi_precision/expression.hpp"
 
 void test_simple_sparse_poly(){
     typedef cpp_multi_precision::sparse_poly<int, int> sparse_poly;
@@ -271,6 +275,636 @@ void test_integer(){
     std::cout << "end of test_integer\n\n";
 }
 
+void test_integer_multi(){
+    typedef cpp_multi_precision::integer<
+        unsigned int,
+        32,
+        long long,
+        unsigned long long,
+        std::vector<unsigned int>
+    > integer;
+
+    std::cout << "start test_integer_multi\n";
+
+    // 筆算, Karatsuba, Toom-3, Toom-4, NTT の各段を通る桁数で (a + b)(a - b) = a^2 - b^2 を確かめる
+    std::size_t sizes[] = { 8, 40, 300, 1000, 2000, 5000 };
+    for(std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i){
+        std::vector<unsigned int> va(sizes[i]), vb(sizes[i] * 3 / 4);
+        for(std::size_t j = 0; j < va.size(); ++j){ va[j] = static_cast<unsigned int>(j * 2654435761u + 1); }
+        for(std::size_t j = 0; j < vb.size(); ++j){ vb[j] = static_cast<unsigned int>(j * 40503u + 7); }
+        integer a(va.begin(), va.end()), b(vb.begin(), vb.end());
+        std::cout << sizes[i] << " : " << ((a + b) * (a - b) == a * a - b * b ? "ok" : "ng") << "\n";
+    }
+
+    std::cout << "end of test_integer_multi\n\n";
+}
+
+void test_integer_div(){
+    typedef cpp_multi_precision::integer<
+        unsigned int,
+        32,
+        long long,
+        unsigned long long,
+        std::vector<unsigned int>
+    > integer;
+
+    std::cout << "start test_integer_div\n";
+
+    // Knuth D, Burnikel-Ziegler, Newton 逆数の各段を通る桁数で a = q * b + r, 0 <= r < b を確かめる
+    std::size_t sizes[] = { 8, 40, 300, 2000, 20000 };
+    for(std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i){
+        std::vector<unsigned int> va(sizes[i] * 2), vb(sizes[i]);
+        for(std::size_t j = 0; j < va.size(); ++j){ va[j] = static_cast<unsigned int>(j * 2654435761u + 1); }
+        for(std::size_t j = 0; j < vb.size(); ++j){ vb[j] = static_cast<unsigned int>(j * 40503u + 7); }
+        integer a(va.begin(), va.end()), b(vb.begin(), vb.end()), q(a / b), r(a % b);
+        std::cout << sizes[i] << " : " << (q * b + r == a && r < b ? "ok" : "ng") << "\n";
+    }
+
+    // 同じ除数で繰り返し割る場合は逆数を使い回せる
+    {
+        std::vector<unsigned int> vb(300);
+        for(std::size_t j = 0; j < vb.size(); ++j){ vb[j] = static_cast<unsigned int>(j * 40503u + 7); }
+        integer b(vb.begin(), vb.end()), a(b * b * b + 12345), q, r;
+        integer::reciprocal inv_b(b);
+        inv_b.div(q, r, a);
+        std::cout << "reciprocal : " << (q == b * b && r == 12345 ? "ok" : "ng") << "\n";
+
+        // 負の被除数, 除数でも / と % に一致し, 使い回した q, r の符号が残らない
+        bool ok = true;
+        for(int i = 0; i < 4; ++i){
+            integer x(i & 1 ? -a : a), y(i & 2 ? -b : b);
+            integer::reciprocal inv_y(y);
+            inv_y.div(q, r, x);
+            ok = ok && q == x / y && r == x % y && q.sign == (x / y).sign && r.sign == (x % y).sign;
+            inv_y.mod(r, x);
+            ok = ok && r == x % y && inv_y.divisor_value() == y;
+        }
+        std::cout << "signed reciprocal : " << (ok ? "ok" : "ng") << "\n";
+
+        // 0 の逆数は作れない
+        try{
+            integer::reciprocal inv_zero(integer(0));
+            ok = false;
+        }catch(const std::domain_error&){}
+        std::cout << "zero divisor : " << (ok ? "ok" : "ng") << "\n";
+    }
+
+    std::cout << "end of test_integer_div\n\n";
+}
+
+void test_integer_gcd(){
+    typedef cpp_multi_precision::integer<
+        unsigned int,
+        32,
+        long long,
+        unsigned long long,
+        std::vector<unsigned int>
+    > integer;
+
+    std::cout << "start test_integer_gcd\n";
+
+    // Lehmer と half-GCD の各段を通る桁数で s * a + t * b = gcd(a, b) を確かめる
+    std::size_t sizes[] = { 8, 300, 4000 };
+    for(std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i){
+        std::vector<unsigned int> vx(sizes[i]), vy(sizes[i]), vg(sizes[i] / 4 + 1);
+        for(std::size_t j = 0; j < vx.size(); ++j){ vx[j] = static_cast<unsigned int>(j * 2654435761u + 1); }
+        for(std::size_t j = 0; j < vy.size(); ++j){ vy[j] = static_cast<unsigned int>(j * 40503u + 7); }
+        for(std::size_t j = 0; j < vg.size(); ++j){ vg[j] = static_cast<unsigned int>(j * 69069u + 3); }
+        integer x(vx.begin(), vx.end()), y(vy.begin(), vy.end()), g(vg.begin(), vg.end()), a(g * x), b(-(g * y)), s, t;
+        integer d = integer::gcd(a, b), e = integer::eea(s, t, a, b);
+        std::cout << sizes[i] << " : " << (d == e && d % g == 0 && s * a + t * b == d ? "ok" : "ng") << "\n";
+    }
+
+    // 法が奇数なら x * x^-1 = 1 (mod m)
+    {
+        std::vector<unsigned int> vm(4000);
+        for(std::size_t j = 0; j < vm.size(); ++j){ vm[j] = static_cast<unsigned int>(j * 40503u + 7); }
+        integer m(vm.begin(), vm.end()), x(m / 3 + 2), inv_x;
+        m = m * 2 + 1;
+        if(integer::gcd(x, m) == 1){
+            inv_x = integer::modular_inverse(x, m);
+            std::cout << "modular_inverse : " << (x * inv_x % m == 1 ? "ok" : "ng") << "\n";
+        }
+    }
+
+    std::cout << "end of test_integer_gcd\n\n";
+}
+
+void test_integer_sqrt(){
+    typedef cpp_multi_precision::integer<
+        unsigned int,
+        32,
+        long long,
+        unsigned long long,
+        std::vector<unsigned int>
+    > integer;
+
+    std::cout << "start test_integer_sqrt\n";
+
+    // 奇数桁と偶数桁で s^2 + r = a, 0 <= r <= 2s を確かめる
+    std::size_t sizes[] = { 1, 7, 300, 4001 };
+    for(std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i){
+        std::vector<unsigned int> va(sizes[i]);
+        for(std::size_t j = 0; j < va.size(); ++j){ va[j] = static_cast<unsigned int>(j * 2654435761u + 1); }
+        integer a(va.begin(), va.end()), s, r;
+        integer::sqrtrem(s, r, a);
+        std::cout << sizes[i] << " : " << (s * s + r == a && r <= s * 2 ? "ok" : "ng") << "\n";
+    }
+
+    // 平方数とその前後
+    {
+        std::vector<unsigned int> vx(500);
+        for(std::size_t j = 0; j < vx.size(); ++j){ vx[j] = static_cast<unsigned int>(j * 40503u + 7); }
+        integer x(vx.begin(), vx.end()), a(x * x);
+        bool ok = a.is_perfect_square() && !(a - 1).is_perfect_square() && !(a + 1).is_perfect_square() && a.sqrt() == x && (a - 1).sqrt() == x - 1;
+        std::cout << "perfect square : " << (ok ? "ok" : "ng") << "\n";
+    }
+
+    std::cout << "end of test_integer_sqrt\n\n";
+}
+
+void test_integer_root(){
+    typedef cpp_multi_precision::integer<
+        unsigned int,
+        32,
+        long long,
+        unsigned long long,
+        std::vector<unsigned int>
+    > integer;
+
+    std::cout << "start test_integer_root\n";
+
+    // s^k <= a < (s + 1)^k を確かめる
+    std::size_t sizes[] = { 1, 9, 300, 2001 };
+    unsigned int ks[] = { 3, 5, 17 };
+    for(std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i){
+        std::vector<unsigned int> va(sizes[i]);
+        for(std::size_t j = 0; j < va.size(); ++j){ va[j] = static_cast<unsigned int>(j * 2654435761u + 1); }
+        integer a(va.begin(), va.end()), s, r;
+        for(std::size_t j = 0; j < sizeof(ks) / sizeof(ks[0]); ++j){
+            integer::rootrem(s, r, a, ks[j]);
+            std::cout << sizes[i] << ", " << ks[j] << " : " << (integer::pow(s, ks[j]) + r == a && integer::pow(s + 1, ks[j]) > a ? "ok" : "ng") << "\n";
+        }
+    }
+
+    // 累乗数とその前後, 負数
+    {
+        std::vector<unsigned int> vx(100);
+        for(std::size_t j = 0; j < vx.size(); ++j){ vx[j] = static_cast<unsigned int>(j * 40503u + 7); }
+        integer x(vx.begin(), vx.end()), a(integer::pow(x, 7));
+        bool ok = a.is_perfect_power() && !(a + 1).is_perfect_power() && a.root(7) == x && (-a).is_perfect_power() && !(-integer::pow(x, 2)).is_perfect_power();
+        std::cout << "perfect power : " << (ok ? "ok" : "ng") << "\n";
+    }
+
+    std::cout << "end of test_integer_root\n\n";
+}
+
+void test_integer_pow(){
+    typedef cpp_multi_precision::integer<
+        unsigned int,
+        32,
+        long long,
+        unsigned long long,
+        std::vector<unsigned int>
+    > integer;
+    typedef integer::unsigned_integer_type unsigned_integer;
+
+    std::cout << "start test_integer_pow\n";
+
+    // 指数 0 と, 前の値が残っている result への代入
+    {
+        unsigned_integer r(7), x(5), m(1000003);
+        unsigned_integer::pow(r, x, unsigned_integer(0));
+        bool ok = r == 1;
+        unsigned_integer::pow(r, x, unsigned_integer(3));
+        ok = ok && r == 125;
+        unsigned_integer::pow(r, x, unsigned_integer(0));
+        ok = ok && r == 1;
+        integer s(-7);
+        integer::pow_mod(s, integer(5), integer(0), integer(1000003));
+        ok = ok && s == 1;
+        integer::pow_mod(s, integer(5), integer(3), integer(1000003));
+        ok = ok && s == 125;
+        std::cout << "zero exponent : " << (ok ? "ok" : "ng") << "\n";
+    }
+
+    // 窓幅の切り替わる指数で x^(e + 1) = x^e * x を確かめる
+    {
+        std::vector<unsigned int> vx(20);
+        for(std::size_t j = 0; j < vx.size(); ++j){ vx[j] = static_cast<unsigned int>(j * 2654435761u + 1); }
+        integer x(vx.begin(), vx.end()), r(x * x * x), t;
+        unsigned int es[] = { 1, 2, 255, 300, 1000 };
+        bool ok = true;
+        for(std::size_t i = 0; i < sizeof(es) / sizeof(es[0]); ++i){
+            integer::pow(t, x, integer(es[i]));
+            integer::pow(r, x, integer(es[i] + 1));
+            ok = ok && r == t * x;
+        }
+        std::cout << "reused result : " << (ok ? "ok" : "ng") << "\n";
+    }
+
+    std::cout << "end of test_integer_pow\n\n";
+}
+
+void test_integer_limb64(){
+    typedef cpp_multi_precision::integer<
+        unsigned int,
+        32,
+        long long,
+        unsigned long long,
+        std::vector<unsigned int>
+    > integer32;
+
+    typedef cpp_multi_precision::integer<
+        unsigned long long,
+        64,
+        __int128,
+        unsigned __int128,
+        std::vector<unsigned long long>
+    > integer64;
+
+    std::cout << "start test_integer_limb64\n";
+
+    // 同じ値を 32 bit limb と 64 bit limb で計算して 10 進文字列が一致することを確かめる
+    std::size_t sizes[] = { 3, 40, 300, 3000 };
+    for(std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i){
+        std::vector<unsigned int> va(sizes[i] * 2), vb(sizes[i]);
+        for(std::size_t j = 0; j < va.size(); ++j){ va[j] = static_cast<unsigned int>(j * 2654435761u + 1); }
+        for(std::size_t j = 0; j < vb.size(); ++j){ vb[j] = static_cast<unsigned int>(j * 40503u + 7); }
+        std::vector<unsigned long long> wa(sizes[i]), wb(sizes[i] / 2 + 1, 0);
+        for(std::size_t j = 0; j < va.size(); ++j){ wa[j / 2] |= static_cast<unsigned long long>(va[j]) << (j % 2 * 32); }
+        for(std::size_t j = 0; j < vb.size(); ++j){ wb[j / 2] |= static_cast<unsigned long long>(vb[j]) << (j % 2 * 32); }
+        integer32 a(va.begin(), va.end()), b(vb.begin(), vb.end()), g32, s32;
+        integer64 c(wa.begin(), wa.end()), d(wb.begin(), wb.end()), g64, s64, e;
+        integer32::gcd(g32, a * 6, b * 4), integer64::gcd(g64, c * 6, d * 4);
+        integer32::sqrt(s32, a), integer64::sqrt(s64, c);
+        e.read((c - d * d).to_string());
+        bool ok =
+            (a * b).to_string() == (c * d).to_string() && (a * a).to_string() == (c * c).to_string() &&
+            (a / b).to_string() == (c / d).to_string() && (a % b).to_string() == (c % d).to_string() &&
+            (a - b * b).to_string() == (c - d * d).to_string() && ((a << 77) >> 13).to_string() == ((c << 77) >> 13).to_string() &&
+            g32.to_string() == g64.to_string() && s32.to_string() == s64.to_string() && e == c - d * d;
+        std::cout << sizes[i] << " : " << (ok ? "ok" : "ng") << "\n";
+    }
+
+    std::cout << "end of test_integer_limb64\n\n";
+}
+
+template<class Radix>
+void fill_limbs(std::vector<Radix> &v, std::size_t seed){
+    unsigned long long x = seed * 6364136223846793005ull + 1442695040888963407ull;
+    for(std::size_t j = 0; j < v.size(); ++j){
+        x = x * 6364136223846793005ull + 1442695040888963407ull;
+        v[j] = j % 5 == 0 ? static_cast<Radix>(~static_cast<Radix>(0)) : j % 7 == 0 ? 0 : static_cast<Radix>(x ^ (x >> 29) * 2654435761u);
+    }
+}
+
+template<class Kernel, class Simd>
+bool check_limb_simd(){
+    typedef typename Kernel::radix_type radix_type;
+    typedef cpp_multi_precision::aux::limb_scalar<radix_type> scalar;
+    bool ok = true;
+    for(std::size_t n = 0; n < 80; ++n){
+        std::vector<radix_type> a(n + 1), b(n + 1), r(n + 1), t(n + 1);
+        fill_limbs(a, n), fill_limbs(b, n + 100);
+        ok = ok && Kernel::template add_n_impl<Simd>(&r[0], &a[0], &b[0], n) == Kernel::template add_n_impl<scalar>(&t[0], &a[0], &b[0], n) && r == t;
+        ok = ok && Kernel::template sub_n_impl<Simd>(&r[0], &a[0], &b[0], n) == Kernel::template sub_n_impl<scalar>(&t[0], &a[0], &b[0], n) && r == t;
+        for(std::size_t shift = 1; shift < Kernel::radix_log2; shift += 7){
+            ok = ok && Kernel::template lshift_impl<Simd>(&r[0], &a[0], n, shift) == Kernel::template lshift_impl<scalar>(&t[0], &a[0], n, shift) && r == t;
+            ok = ok && Kernel::template rshift_impl<Simd>(&r[0], &a[0], n, shift) == Kernel::template rshift_impl<scalar>(&t[0], &a[0], n, shift) && r == t;
+        }
+        for(std::size_t k = 0; k < n; k += 3){
+            b = a, b[k] ^= 1;
+            ok = ok && Kernel::template cmp_impl<Simd>(&a[0], &b[0], n) == Kernel::template cmp_impl<scalar>(&a[0], &b[0], n);
+            ok = ok && Kernel::template cmp_impl<Simd>(&a[0], &a[0], n) == 0;
+            b = a, std::fill(b.begin() + k, b.end(), 0);
+            ok = ok && Kernel::template normalized_size_impl<Simd>(&b[0], n) == Kernel::template normalized_size_impl<scalar>(&b[0], n);
+        }
+    }
+    return ok;
+}
+
+template<class Kernel, class Mul>
+bool check_limb_mul(){
+    typedef typename Kernel::radix_type radix_type;
+    typedef cpp_multi_precision::aux::limb_scalar<radix_type> scalar;
+    bool ok = true;
+    for(std::size_t n = 0; n < 40; ++n){
+        std::vector<radix_type> a(n + 1), r(n + 1), t(n + 1);
+        fill_limbs(a, n), fill_limbs(r, n + 100), t = r;
+        radix_type bs[] = { 0, 1, static_cast<radix_type>(~static_cast<radix_type>(0)), a[0] | 1 };
+        for(std::size_t i = 0; i < sizeof(bs) / sizeof(bs[0]); ++i){
+            ok = ok && Kernel::template addmul_1_impl<Mul>(&r[0], &a[0], n, bs[i]) == Kernel::template addmul_1_impl<scalar>(&t[0], &a[0], n, bs[i]) && r == t;
+            ok = ok && Kernel::template submul_1_impl<Mul>(&r[0], &a[0], n, bs[i]) == Kernel::template submul_1_impl<scalar>(&t[0], &a[0], n, bs[i]) && r == t;
+            ok = ok && Kernel::template mul_1_impl<Mul>(&r[0], &a[0], n, bs[i]) == Kernel::template mul_1_impl<scalar>(&t[0], &a[0], n, bs[i]) && r == t;
+        }
+    }
+    return ok;
+}
+
+template<class Prime, class Ntt>
+bool check_ntt_stage(){
+    typedef typename Prime::value_type value_type;
+    std::size_t n = 256;
+    std::vector<value_type> a(n), b, w(n);
+    for(std::size_t j = 0; j < n; ++j){
+        a[j] = static_cast<value_type>((j * 2654435761u + 1) % Prime::mod);
+        w[j] = static_cast<value_type>((j * 40503u + 7) % Prime::mod);
+    }
+    bool ok = true;
+    for(std::size_t m = 2; m <= n; m <<= 1){
+        b = a;
+        Ntt::forward_stage(&a[0], n, m, &w[0]), Prime::forward_stage(&b[0], n, m, &w[0]);
+        ok = ok && a == b;
+        Ntt::inverse_stage(&a[0], n, m, &w[0]), Prime::inverse_stage(&b[0], n, m, &w[0]);
+        ok = ok && a == b;
+    }
+    return ok;
+}
+
+void test_limb_kernel(){
+    typedef cpp_multi_precision::aux::limb_kernel<unsigned int, unsigned long long, 32> kernel32;
+    typedef cpp_multi_precision::aux::limb_kernel<unsigned long long, unsigned __int128, 64> kernel64;
+
+    std::cout << "start test_limb_kernel\n";
+
+    // 実行環境が選ぶ経路に関係なく, 使える SIMD 版と mulx 版の各 kernel が scalar 版と一致することを確かめる
+#ifdef CPP_MULTI_PRECISION_SIMD_X86
+    typedef cpp_multi_precision::aux::ntt_prime_set<unsigned int, unsigned long long> prime_set;
+    const cpp_multi_precision::aux::cpu_features &f = cpp_multi_precision::aux::cpu_features::get();
+    if(f.avx2){
+        bool ok =
+            check_limb_simd<kernel32, cpp_multi_precision::aux::limb_avx2<unsigned int, 32>>() &&
+            check_limb_simd<kernel64, cpp_multi_precision::aux::limb_avx2<unsigned long long, 64>>() &&
+            check_ntt_stage<prime_set::prime1_type, cpp_multi_precision::aux::ntt_avx2<prime_set::prime1_type>>() &&
+            check_ntt_stage<prime_set::prime2_type, cpp_multi_precision::aux::ntt_avx2<prime_set::prime2_type>>() &&
+            check_ntt_stage<prime_set::prime3_type, cpp_multi_precision::aux::ntt_avx2<prime_set::prime3_type>>();
+        std::cout << "avx2 : " << (ok ? "ok" : "ng") << "\n";
+    }else{
+        std::cout << "avx2 : skipped\n";
+    }
+    if(f.avx512f){
+        bool ok =
+            check_limb_simd<kernel32, cpp_multi_precision::aux::limb_avx512<unsigned int, 32>>() &&
+            check_limb_simd<kernel64, cpp_multi_precision::aux::limb_avx512<unsigned long long, 64>>() &&
+            check_ntt_stage<prime_set::prime1_type, cpp_multi_precision::aux::ntt_avx512<prime_set::prime1_type>>() &&
+            check_ntt_stage<prime_set::prime2_type, cpp_multi_precision::aux::ntt_avx512<prime_set::prime2_type>>() &&
+            check_ntt_stage<prime_set::prime3_type, cpp_multi_precision::aux::ntt_avx512<prime_set::prime3_type>>();
+        std::cout << "avx512 : " << (ok ? "ok" : "ng") << "\n";
+    }else{
+        std::cout << "avx512 : skipped\n";
+    }
+    if(sizeof(void*) == 8 && f.bmi2 && f.adx){
+        bool ok = check_limb_mul<kernel64, cpp_multi_precision::aux::limb_mulx<unsigned long long, 64>>();
+        std::cout << "mulx : " << (ok ? "ok" : "ng") << "\n";
+    }else{
+        std::cout << "mulx : skipped\n";
+    }
+#else
+    std::cout << "simd : skipped\n";
+#endif
+    std::cout << "scalar : " << (check_limb_simd<kernel64, cpp_multi_precision::aux::limb_scalar<unsigned long long>>() && check_limb_mul<kernel32, cpp_multi_precision::aux::limb_scalar<unsigned int>>() ? "ok" : "ng") << "\n";
+
+    std::cout << "end of test_limb_kernel\n\n";
+}
+
+void test_integer_small(){
+    typedef cpp_multi_precision::integer<
+        unsigned int,
+        32,
+        long long,
+        unsigned long long,
+        std::vector<unsigned int>
+    > integer_vector;
+
+    typedef cpp_multi_precision::integer<
+        unsigned int,
+        32,
+        long long,
+        unsigned long long,
+        cpp_multi_precision::storaged_container<4>::small_vector<unsigned int>
+    > integer_small;
+
+    std::cout << "start test_integer_small\n";
+
+    // inline に収まる値とヒープに溢れる値の両方で std::vector 版と結果が一致することを確かめる
+    long long values[] = { 0, 1, -1, 7, -13, 4294967295ll, -4294967296ll, 9223372036854775807ll, -9223372036854775807ll };
+    std::size_t n = sizeof(values) / sizeof(values[0]);
+    bool ok = true;
+    for(std::size_t i = 0; i < n; ++i){
+        for(std::size_t j = 0; j < n; ++j){
+            integer_vector a(values[i]), b(values[j]);
+            integer_small c(values[i]), d(values[j]);
+            ok = ok &&
+                (a + b).to_string() == (c + d).to_string() && (a - b).to_string() == (c - d).to_string() &&
+                (a * b).to_string() == (c * d).to_string() && (a * a * b * b).to_string() == (c * c * d * d).to_string() &&
+                (a < b) == (c < d);
+            if(values[j] != 0){
+                ok = ok && (a / b).to_string() == (c / d).to_string() && (a % b).to_string() == (c % d).to_string();
+            }
+        }
+    }
+    std::cout << (ok ? "ok" : "ng") << "\n";
+
+    std::cout << "end of test_integer_small\n\n";
+}
+
+void test_integer_pool(){
+    typedef cpp_multi_precision::integer<
+        unsigned int,
+        32,
+        long long,
+        unsigned long long,
+        std::vector<unsigned int>
+    > integer_vector;
+
+    typedef cpp_multi_precision::integer<
+        unsigned int,
+        32,
+        long long,
+        unsigned long long,
+        std::vector<unsigned int>,
+        cpp_multi_precision::pool_allocator<unsigned int>
+    > integer_pool;
+
+    std::cout << "start test_integer_pool\n";
+
+    // 同じ計算を std::allocator, pool_allocator, pool_arena の下で行い結果が一致することを確かめる
+    integer_vector a(1);
+    for(int i = 0; i < 40; ++i){ a = a * 4294967291ll + i; }
+    std::string s = a.to_string(), r[2];
+    for(int k = 0; k < 2; ++k){
+        cpp_multi_precision::pool_arena *arena = k == 1 ? new cpp_multi_precision::pool_arena : 0;
+        {
+            integer_pool b, m;
+            b.read(s), m.read(s);
+            for(int i = 0; i < 1000; ++i){ b = (b * b + i) % m; }
+            r[k] = b.to_string();
+        }
+        delete arena;
+    }
+    integer_vector c(a);
+    for(int i = 0; i < 1000; ++i){ c = (c * c + i) % a; }
+    const cpp_multi_precision::pool_statistics &st = cpp_multi_precision::pool_allocator<unsigned int>::statistics();
+    std::cout << (r[0] == c.to_string() && r[1] == c.to_string() ? "ok" : "ng") << "\n";
+    std::cout << "allocations : " << st.allocations << ", system allocations : " << st.system_allocations << "\n";
+
+    // 別スレッドで解放したブロックはそのスレッドの統計とフリーリストを壊さずにシステムへ返る
+    {
+        bool ok = true;
+        for(int k = 0; k < 2; ++k){
+            cpp_multi_precision::pool_arena *arena = k == 1 ? new cpp_multi_precision::pool_arena : 0;
+            {
+                integer_pool x;
+                x.read(s);
+                std::thread t([&x, &ok](){
+                    {
+                        integer_pool y(std::move(x));
+                        y += 1;
+                    }
+                    const cpp_multi_precision::pool_statistics &ts = cpp_multi_precision::pool_allocator<unsigned int>::statistics();
+                    ok = ok && ts.foreign_deallocations == 1 && ts.bytes_in_use == 0;
+                });
+                t.join();
+            }
+            delete arena;
+        }
+        std::cout << "foreign deallocation : " << (ok ? "ok" : "ng") << "\n";
+    }
+
+    std::cout << "end of test_integer_pool\n\n";
+}
+
+void test_integer_expression(){
+    typedef cpp_multi_precision::integer<
+        unsigned int,
+        32,
+        long long,
+        unsigned long long,
+        std::vector<unsigned int>
+    > integer_type;
+    using cpp_multi_precision::expression::lazy;
+
+    std::cout << "start test_integer_expression\n";
+
+    // 式テンプレートで評価した結果と通常の演算子で評価した結果が一致することを確かめる
+    integer_type a, b, c, d, e, m;
+    a.read("-123456789012345678901234567890123456789");
+    b.read("98765432109876543210987654321");
+    c.read("-55555555555555555555");
+    d.read("77777777777777777777777777777777777777777777");
+    e.read("31415926535897932384626433832795028841971");
+    m.read("1000000000000000000000000000057");
+    integer_type r, s(a);
+    r = lazy(a) * b + lazy(c) * d - e;
+    bool ok = r == a * b + c * d - e;
+    r = (lazy(a) * b) % m;
+    ok = ok && r == (a * b) % m;
+    r = e - lazy(a) * b;
+    ok = ok && r == e - a * b;
+    s = lazy(s) - lazy(b) * s;
+    ok = ok && s == a - b * a;
+    s += lazy(c) * d;
+    ok = ok && s == a - b * a + c * d;
+    std::cout << (ok ? "ok" : "ng") << "\n";
+
+    std::cout << "end of test_integer_expression\n\n";
+}
+
+void test_integer_addmul(){
+    typedef cpp_multi_precision::integer<
+        unsigned int,
+        32,
+        long long,
+        unsigned long long,
+        std::vector<unsigned int>
+    > integer_type;
+
+    std::cout << "start test_integer_addmul\n";
+
+    // addmul, submul, dot の結果が積を作ってから足した結果と一致することを確かめる
+    std::vector<integer_type> xs, ys;
+    integer_type acc, ref;
+    acc.read("-98765432109876543210987654321098765432109876543210");
+    ref = acc;
+    for(int i = 0; i < 50; ++i){
+        integer_type x(1), y(-7);
+        for(int j = 0; j < i; ++j){ x = x * 4294967291ll + j, y = y * 65537 - j; }
+        xs.push_back(x), ys.push_back(y);
+    }
+    bool ok = true;
+    for(std::size_t i = 0; i < xs.size(); ++i){
+        integer_type::addmul(acc, xs[i], ys[i]), ref += xs[i] * ys[i];
+        ok = ok && acc == ref;
+        integer_type::submul(acc, ys[i], ys[i]), ref -= ys[i] * ys[i];
+        ok = ok && acc == ref;
+    }
+    integer_type d = integer_type::dot(xs.begin(), xs.end(), ys.begin()), e;
+    for(std::size_t i = 0; i < xs.size(); ++i){ e += xs[i] * ys[i]; }
+    ok = ok && d == e;
+    std::cout << (ok ? "ok" : "ng") << "\n";
+
+    std::cout << "end of test_integer_addmul\n\n";
+}
+
+void test_integer_word(){
+    typedef cpp_multi_precision::integer<
+        unsigned int,
+        32,
+        long long,
+        unsigned long long,
+        std::vector<unsigned int>
+    > integer_type;
+
+    std::cout << "start test_integer_word\n";
+
+    // 整数型との演算が integer に変換してからの演算と一致することを確かめる
+    integer_type a;
+    a.read("-340282366920938463463374607431768211457");
+    long long ws[] = { 0, 1, -1, 3, -7, 4294967295ll, -4294967296ll, 9223372036854775807ll };
+    bool ok = true;
+    for(std::size_t i = 0; i < sizeof(ws) / sizeof(ws[0]); ++i){
+        long long w = ws[i];
+        integer_type b(w), x(a);
+        ok = ok && a + w == a + b && a - w == a - b && a * w == a * b && w - a == b - a && w * a == b * a;
+        ok = ok && (a < w) == (a < b) && (a == w) == (a == b) && (w <= a) == (b <= a);
+        if(w != 0){ ok = ok && a / w == a / b && a % w == a % b; }
+        x += w, x *= w, x -= w;
+        ok = ok && x == (a + b) * b - b;
+    }
+    std::cout << (ok ? "ok" : "ng") << "\n";
+
+    std::cout << "end of test_integer_word\n\n";
+}
+
+void test_integer_divexact(){
+    typedef cpp_multi_precision::integer<
+        unsigned int,
+        32,
+        long long,
+        unsigned long long,
+        std::vector<unsigned int>
+    > integer_type;
+
+    std::cout << "start test_integer_divexact\n";
+
+    // 割り切れることが分かっている除算が通常の除算と一致することを確かめる
+    integer_type a, b, c;
+    a.read("-340282366920938463463374607431768211457");
+    b.read("18446744073709551616000000000000000000000000007");
+    bool ok = true;
+    for(int i = 0; i < 8; ++i){
+        c = a * b;
+        ok = ok && integer_type::divexact(c, b) == a && integer_type::divexact(c, a) == b;
+        ok = ok && integer_type::divexact(c * -3, integer_type(-3)) == c;
+        a = a * a + 12345, b = -(b << 37);
+    }
+    ok = ok && integer_type::divexact(integer_type(0), b) == 0;
+    std::cout << (ok ? "ok" : "ng") << "\n";
+
+    std::cout << "end of test_integer_divexact\n\n";
+}
+
 void test_modular(){
     typedef cpp_multi_precision::integer<
         unsigned int,
@@ -396,6 +1030,20 @@ int main(){
     test_sparse_poly();
     //test_rational();
     //test_integer();
+    //test_integer_multi();
+    //test_integer_div();
+    //test_integer_gcd();
+    //test_integer_sqrt();
+    //test_integer_root();
+    //test_integer_pow();
+    //test_integer_limb64();
+    //test_limb_kernel();
+    //test_integer_small();
+    //test_integer_pool();
+    //test_integer_expression();
+    //test_integer_addmul();
+    //test_integer_word();
+    //test_integer_divexact();
     //test_modular_and_poly();
 
     return 0;